@@ -26,27 +26,29 @@ class DataWrangler:
     def getPatchLevel(self, lvl):
         return self.cpp.getPatchLevel(lvl)
 
-    def _lvl0FullContiguous(self, input, is_primal=True):
-        return self.cpp.sync_merge(input, is_primal)
+    def _lvl0FullContiguous(self, input, is_primal=True, root_only=False):
+        return self.cpp.sync_merge(input, is_primal, root_only)
 
-    def lvl0IonDensity(self):
-        return self._lvl0FullContiguous(self.getPatchLevel(0).getDensity())
+    # with root_only=True, data is only gathered on MPI rank 0, other ranks get empty arrays
 
-    def lvl0BulkVelocity(self):
+    def lvl0IonDensity(self, root_only=False):
+        return self._lvl0FullContiguous(self.getPatchLevel(0).getDensity(), root_only=root_only)
+
+    def lvl0BulkVelocity(self, root_only=False):
         return {
-            xyz: self._lvl0FullContiguous(bv)
+            xyz: self._lvl0FullContiguous(bv, root_only=root_only)
             for xyz, bv in self.getPatchLevel(0).getBulkVelocity().items()
         }
 
-    def lvl0PopDensity(self):
+    def lvl0PopDensity(self, root_only=False):
         return {
-            pop: self._lvl0FullContiguous(density)
+            pop: self._lvl0FullContiguous(density, root_only=root_only)
             for pop, density in self.getPatchLevel(0).getPopDensities().items()
         }
 
-    def lvl0PopFluxes(self):
+    def lvl0PopFluxes(self, root_only=False):
         return {
-            pop: {xyz: self._lvl0FullContiguous(data) for xyz, data in flux.items()}
+            pop: {xyz: self._lvl0FullContiguous(data, root_only=root_only) for xyz, data in flux.items()}
             for pop, flux in self.getPatchLevel(0).getPopFluxes().items()
         }
 
@@ -54,11 +56,11 @@ class DataWrangler:
         """ extract "ex" from "EM_E_x"  """
         return "".join(em_xyz.lower().split("_"))[2:]
 
-    def lvl0EM(self):
+    def lvl0EM(self, root_only=False):
         return {
             em: {
                 em_xyz: self.cpp.sync_merge(
-                    data, DataWrangler.is_primal[self.extract_is_primal_key_from(em_xyz)]
+                    data, DataWrangler.is_primal[self.extract_is_primal_key_from(em_xyz)], root_only
                 )
                 for em_xyz, data in xyz_map.items()
             }
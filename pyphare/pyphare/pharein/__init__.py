@@ -21,8 +21,9 @@ import numpy as np
 from .uniform_model import UniformModel
 from .maxwellian_fluid_model import MaxwellianFluidModel
 from .electron_model import ElectronModel
-from .diagnostics import FluidDiagnostics, ElectromagDiagnostics, ParticleDiagnostics
+from .diagnostics import FluidDiagnostics, ElectromagDiagnostics, ParticleDiagnostics, ReducedDiagnostics
 from .simulation import Simulation
+from .profiles import Profile
 
 
 def getSimulation():
@@ -66,13 +67,24 @@ class fn_wrapper:
 
 
 
-def populateDict():
+# pp is the C++ dict module by default, or any object with the same functions,
+#  like the DictWriter of pharein.serialize
+def populateDict(pp=None):
 
     from .global_vars import sim as simulation
-    import pybindlibs.dictator as pp
+    if pp is None:
+        import pybindlibs.dictator as pp
 
     add = pp.add
-    addInitFunction = getattr(pp, 'addInitFunction{:d}'.format(simulation.dims)+'D')
+    addPyInitFunction = getattr(pp, 'addInitFunction{:d}'.format(simulation.dims)+'D')
+    addProfile = getattr(pp, 'addProfile{:d}'.format(simulation.dims)+'D')
+
+    # analytic profiles are evaluated in C++, other functions are called through fn_wrapper
+    def addInitFunction(path, fn):
+        if isinstance(fn, Profile):
+            addProfile(path, fn.name, fn.cpp_parameters())
+        else:
+            addPyInitFunction(path, fn_wrapper(fn))
 
     add("simulation/name", "simulation_test")
     add("simulation/dimension", simulation.dims)
@@ -109,6 +121,22 @@ def populateDict():
 
     add("simulation/AMR/max_nbr_levels", int(simulation.max_nbr_levels))
     add("simulation/AMR/nesting_buffer", int(simulation.nesting_buffer))
+    add("simulation/AMR/load_balancing/rebalance_interval", int(simulation.rebalance_interval))
+    add("simulation/level_initializer/threads", int(simulation.level_init_threads))
+    add("simulation/timers_file", simulation.timers_file)
+    add("simulation/timers_interval", int(simulation.timers_interval))
+    if simulation.log_file is not None:
+        add("simulation/log_file", simulation.log_file)
+
+    restart_options = simulation.restart_options
+    restart_time = None
+    if restart_options is not None:
+        restart_path = "simulation/restarts/"
+        add(restart_path + "filePath", restart_options["dir"])
+        pp.add_array_as_vector(restart_path + "write_timestamps", restart_options["timestamps"])
+        if "restart_time" in restart_options:
+            restart_time = restart_options["restart_time"]
+            add(restart_path + "restart_time", restart_time)
     refinement_boxes = simulation.refinement_boxes
 
 
@@ -144,6 +172,9 @@ def populateDict():
 
     if simulation.refinement == "tagging":
         add("simulation/AMR/refinement/tagging/method","auto")
+        for criterion, threshold in simulation.tagging_thresholds.items():
+            add("simulation/AMR/refinement/tagging/"+criterion, float(threshold))
+        add("simulation/AMR/refinement/tagging/regrid_interval", int(simulation.regrid_interval))
 
 
     add("simulation/algo/ion_updater/pusher/name", simulation.particle_pusher)
@@ -163,18 +194,23 @@ def populateDict():
         add(pop_path+"{:d}/mass".format(pop_index), float(d["mass"]))
         add(partinit_path+"name", "maxwellian")
 
-        addInitFunction(partinit_path+"density", fn_wrapper(d["density"]))
-        addInitFunction(partinit_path+"bulk_velocity_x", fn_wrapper(d["vx"]))
-        addInitFunction(partinit_path+"bulk_velocity_y", fn_wrapper(d["vy"]))
-        addInitFunction(partinit_path+"bulk_velocity_z", fn_wrapper(d["vz"]))
-        addInitFunction(partinit_path+"thermal_velocity_x",fn_wrapper(d["vthx"]))
-        addInitFunction(partinit_path+"thermal_velocity_y",fn_wrapper(d["vthy"]))
-        addInitFunction(partinit_path+"thermal_velocity_z",fn_wrapper(d["vthz"]))
+        addInitFunction(partinit_path+"density", d["density"])
+        addInitFunction(partinit_path+"bulk_velocity_x", d["vx"])
+        addInitFunction(partinit_path+"bulk_velocity_y", d["vy"])
+        addInitFunction(partinit_path+"bulk_velocity_z", d["vz"])
+        addInitFunction(partinit_path+"thermal_velocity_x", d["vthx"])
+        addInitFunction(partinit_path+"thermal_velocity_y", d["vthy"])
+        addInitFunction(partinit_path+"thermal_velocity_z", d["vthz"])
         add(partinit_path+"nbr_part_per_cell", int(d["nbrParticlesPerCell"]))
         add(partinit_path+"charge", float(d["charge"]))
         add(partinit_path+"basis", "cartesian")
         if "init" in d and "seed" in d["init"]:
             pp.add_optional_size_t(partinit_path+"init/seed", d["init"]["seed"])
+        if "init" in d and "threads" in d["init"]:
+            pp.add_size_t(partinit_path+"init/threads", int(d["init"]["threads"]))
+        if "init" in d and d["init"].get("decomposition_independent", False):
+            for axis, origin in zip("xyz", simulation.origin):
+                add(partinit_path+"init/domain_origin/"+axis, float(origin))
 
     add("simulation/electromag/name", "EM")
     add("simulation/electromag/electric/name", "E")
@@ -182,9 +218,9 @@ def populateDict():
 
     add("simulation/electromag/magnetic/name", "B")
     maginit_path = "simulation/electromag/magnetic/initializer/"
-    addInitFunction(maginit_path+"x_component", fn_wrapper(modelDict["bx"]))
-    addInitFunction(maginit_path+"y_component", fn_wrapper(modelDict["by"]))
-    addInitFunction(maginit_path+"z_component", fn_wrapper(modelDict["bz"]))
+    addInitFunction(maginit_path+"x_component", modelDict["bx"])
+    addInitFunction(maginit_path+"y_component", modelDict["by"])
+    addInitFunction(maginit_path+"z_component", modelDict["bz"])
 
     diag_path = "simulation/diagnostics/"
     for diag in simulation.diagnostics:
@@ -192,8 +228,27 @@ def populateDict():
         name_path = type_path + diag.name
         add(name_path + "/" + 'type/' , diag.type)
         add(name_path + "/" + 'quantity/' , diag.quantity)
-        pp.add_array_as_vector(name_path + "/" + "write_timestamps", diag.write_timestamps)
-        pp.add_array_as_vector(name_path + "/" + "compute_timestamps", diag.compute_timestamps)
+        write_timestamps = np.asarray(diag.write_timestamps)
+        compute_timestamps = np.asarray(diag.compute_timestamps)
+        if restart_time is not None: # what precedes the restart has already been written
+            write_timestamps = write_timestamps[write_timestamps > restart_time]
+            compute_timestamps = compute_timestamps[compute_timestamps > restart_time]
+        pp.add_array_as_vector(name_path + "/" + "write_timestamps", write_timestamps)
+        pp.add_array_as_vector(name_path + "/" + "compute_timestamps", compute_timestamps)
+        for key, value in diag.dataset_options.items():
+            add(name_path + "/" + key, value)
+        if diag.type == ParticleDiagnostics.type:
+            for key, value in diag.selection.items():
+                if key == "selection_box":
+                    pp.add_array_as_vector(name_path + "/" + key, np.asarray(value, dtype=np.float64))
+                elif key == "seed": # unsigned 64 bits, does not fit an int
+                    pp.add_size_t(name_path + "/" + key, value)
+                else:
+                    add(name_path + "/" + key, value)
+        if diag.type == ReducedDiagnostics.type and diag.histogram is not None:
+            add(name_path + "/axes", ",".join(diag.histogram["axes"]))
+            pp.add_array_as_vector(name_path + "/nbr_bins", np.asarray(diag.histogram["nbr_bins"], dtype=np.float64))
+            pp.add_array_as_vector(name_path + "/ranges", np.asarray(diag.histogram["ranges"], dtype=np.float64).flatten())
 
 
     if simulation.diag_options is not None and "options" in simulation.diag_options:
@@ -206,6 +261,10 @@ def populateDict():
             add(diag_path + "mode", simulation.diag_options["options"]["mode"])
         if "fine_dump_lvl_max" in simulation.diag_options["options"]:
             add(diag_path + "fine_dump_lvl_max", simulation.diag_options["options"]["fine_dump_lvl_max"])
+        if "max_in_flight_dumps" in simulation.diag_options["options"]:
+            add(diag_path + "max_in_flight_dumps", simulation.diag_options["options"]["max_in_flight_dumps"])
+        if "dataset_layout" in simulation.diag_options["options"]:
+            add(diag_path + "dataset_layout", simulation.diag_options["options"]["dataset_layout"])
 
 
     #### adding electrons
@@ -5,12 +5,55 @@ from . import global_vars
 # ------------------------------------------------------------------------------
 
 
+# storage of the datasets of a diagnostic, see DatasetOptions in diagnostic_props.h
+#  chunk_size : number of elements per chunk, chunked datasets can be compressed
+#  gzip : deflate compression level from 1 to 9, serial HDF5 only, rejected by parallel builds
+#  shuffle : bool, byte shuffling before compression, serial HDF5 only
+#  mantissa_bits : lossy, number of float mantissa bits kept (e.g. 10, half precision accuracy)
+#  quantized_datasets : datasets mantissa_bits applies to (e.g. ["v"]), needed by mantissa_bits
+dataset_option_keywords = ['chunk_size', 'gzip', 'shuffle', 'mantissa_bits', 'quantized_datasets']
+
+
+def dataset_options(**kwargs):
+    options = {}
+
+    for key in ["chunk_size", "mantissa_bits"]:
+        if key in kwargs:
+            if not isinstance(kwargs[key], int) or kwargs[key] < 0:
+                raise ValueError("Error: '{}' must be a positive integer".format(key))
+            options[key] = kwargs[key]
+
+    if "mantissa_bits" in options and options["mantissa_bits"] > 23:
+        raise ValueError("Error: 'mantissa_bits' must be at most 23, the float mantissa size")
+
+    if "gzip" in kwargs:
+        if kwargs["gzip"] not in range(10):
+            raise ValueError("Error: 'gzip' must be a compression level from 0 to 9")
+        options["gzip"] = kwargs["gzip"]
+
+    if "shuffle" in kwargs:
+        options["shuffle"] = int(bool(kwargs["shuffle"]))
+
+    # lossy, nothing is quantized unless listed
+    if ("quantized_datasets" in kwargs) != ("mantissa_bits" in options):
+        raise ValueError("Error: 'mantissa_bits' and 'quantized_datasets' go together")
+    if "quantized_datasets" in kwargs:
+        if len(kwargs["quantized_datasets"]) == 0:
+            raise ValueError("Error: 'quantized_datasets' must list datasets")
+        options["quantized_datasets"] = ",".join(kwargs["quantized_datasets"])
+
+    return options
+
+
+# ------------------------------------------------------------------------------
+
+
 
 def diagnostics_checker(func):
     def wrapper(diagnostics_object, name, **kwargs):
 
         accepted_keywords = ['write_timestamps',
-                             'path', 'compute_timestamps']
+                             'path', 'compute_timestamps'] + dataset_option_keywords
 
         mandatory_keywords = ['write_timestamps', 'quantity']
 
@@ -52,6 +95,7 @@ class Diagnostics(object):
 
         self.write_timestamps = kwargs['write_timestamps'] #[0, 1, 2]
         self.compute_timestamps = kwargs['compute_timestamps']
+        self.dataset_options = dataset_options(**kwargs)
 
         self.__extent = None
 
@@ -171,6 +215,7 @@ class ParticleDiagnostics(Diagnostics):
         self.quantity = kwargs['quantity']
 
         self.space_box(**kwargs)
+        self.selection = self.particle_selection(**kwargs)
 
         if 'population_name' not in kwargs:
             raise ValueError("Error: missing population_name")
@@ -180,6 +225,10 @@ class ParticleDiagnostics(Diagnostics):
         if not population_in_model(self.population_name):
             raise ValueError("Error: population '{}' not in simulation initial model".format(self.population_name))
 
+        # 'space_box' writes the domain particles within the extent
+        if self.quantity == 'space_box':
+            self.quantity = 'domain'
+
         self.quantity = "/ions/pop/" + self.population_name + "/" + self.quantity
 
     def space_box(self, **kwargs):
@@ -189,6 +238,41 @@ class ParticleDiagnostics(Diagnostics):
         elif 'extent' in kwargs:
             self.extent = kwargs['extent']
 
+
+    # particles written, selected in C++ before being copied, see ParticleSelectionOptions
+    #  extent : (min, max) coordinates for each direction
+    #  stride : writes one particle in stride
+    #  fraction : random fraction of the particles written, in (0, 1]
+    #  seed : of the random selection
+    @staticmethod
+    def particle_selection(**kwargs):
+        selection = {}
+
+        if 'extent' in kwargs:
+            extent = kwargs['extent']
+            if len(extent) != 2 * global_vars.sim.dims:
+                raise ValueError("Error: 'extent' expects a (min, max) pair per direction")
+            if any(extent[2 * i] >= extent[2 * i + 1] for i in range(global_vars.sim.dims)):
+                raise ValueError("Error: 'extent' min must be lower than max")
+            selection["selection_box"] = [float(x) for x in extent]
+
+        if 'stride' in kwargs:
+            if not isinstance(kwargs['stride'], int) or kwargs['stride'] < 1:
+                raise ValueError("Error: 'stride' must be a strictly positive integer")
+            selection["stride"] = kwargs['stride']
+
+        if 'fraction' in kwargs:
+            if not 0 < kwargs['fraction'] <= 1:
+                raise ValueError("Error: 'fraction' must be in (0, 1]")
+            selection["fraction"] = float(kwargs['fraction'])
+
+        if 'seed' in kwargs:
+            if not isinstance(kwargs['seed'], int) or not 0 <= kwargs['seed'] < 2**64:
+                raise ValueError("Error: 'seed' must be an unsigned 64 bits integer")
+            selection["seed"] = kwargs['seed']
+
+        return selection
+
     def to_dict(self):
         return {"name": self.name,
                 "type": ParticleDiagnostics.type,
@@ -198,3 +282,102 @@ class ParticleDiagnostics(Diagnostics):
                 "path": self.path,
                 "extent": ", ".join([str(x) for x in self.extent]),
                 "population_name":self.population_name}
+
+
+
+# ------------------------------------------------------------------------------
+
+
+class ReducedDiagnostics(Diagnostics):
+    """
+    diagnostics computed and summed over MPI processes in situ, written per level
+
+    quantity              : 'energy', 'velocity_distribution' or 'phase_space'
+    population_name       : population of the histograms
+    axes                  : histogram axes among 'x', 'y', 'z', 'vx', 'vy', 'vz'
+                            [default=['vx', 'vy', 'vz']] for 'velocity_distribution'
+                            two axes are expected for 'phase_space'
+    nbr_bins              : number of bins, for all axes or one per axis
+    ranges                : (min, max) of all axes or one per axis
+    """
+
+    reduced_quantities = ['energy', 'velocity_distribution', 'phase_space']
+    histogram_axes = ['x', 'y', 'z', 'vx', 'vy', 'vz']
+    type = "reduced"
+
+    def __init__(self, **kwargs):
+        super(ReducedDiagnostics, self).__init__(ReducedDiagnostics.type \
+                                                 + str(global_vars.sim.count_diagnostics(ReducedDiagnostics.type)),
+                                                 **kwargs)
+
+        if 'quantity' not in kwargs:
+            raise ValueError("Error: missing 'quantity' parameter")
+
+        if kwargs['quantity'] not in ReducedDiagnostics.reduced_quantities:
+            error_msg = "Error: '{}' not a valid reduced diagnostics : " + ', '.join(ReducedDiagnostics.reduced_quantities)
+            raise ValueError(error_msg.format(kwargs['quantity']))
+
+        self.population_name = None
+        self.histogram = None
+
+        if kwargs['quantity'] == 'energy':
+            self.quantity = "/energy"
+            return
+
+        if 'population_name' not in kwargs:
+            raise ValueError("Error: missing population_name")
+        self.population_name = kwargs['population_name']
+
+        if not population_in_model(self.population_name) or self.population_name in ["all", "ions"]:
+            raise ValueError("Error: population '{}' not in simulation initial model".format(self.population_name))
+
+        self.histogram = self._histogram(kwargs['quantity'], **kwargs)
+        self.quantity = "/ions/pop/" + self.population_name + "/" + kwargs['quantity']
+
+
+    @staticmethod
+    def _histogram(quantity, **kwargs):
+        axes = kwargs.get('axes', ['vx', 'vy', 'vz'] if quantity == 'velocity_distribution' else None)
+        if axes is None or len(axes) == 0:
+            raise ValueError("Error: missing 'axes' parameter")
+        if quantity == 'phase_space' and len(axes) != 2:
+            raise ValueError("Error: 'phase_space' expects two axes")
+
+        dims = global_vars.sim.dims
+        valid_axes = ReducedDiagnostics.histogram_axes[:dims] + ReducedDiagnostics.histogram_axes[3:]
+        for axis in axes:
+            if axis not in valid_axes:
+                raise ValueError("Error: invalid histogram axis '{}', expected one of {}".format(axis, valid_axes))
+
+        if 'nbr_bins' not in kwargs or 'ranges' not in kwargs:
+            raise ValueError("Error: histograms need 'nbr_bins' and 'ranges'")
+
+        nbr_bins = kwargs['nbr_bins']
+        if not hasattr(nbr_bins, '__len__'):
+            nbr_bins = [nbr_bins] * len(axes)
+
+        ranges = kwargs['ranges']
+        if not hasattr(ranges[0], '__len__'):
+            ranges = [ranges] * len(axes)
+
+        if len(nbr_bins) != len(axes) or len(ranges) != len(axes):
+            raise ValueError("Error: 'nbr_bins' and 'ranges' must be given for all axes or for each")
+
+        for bins, (lower, upper) in zip(nbr_bins, ranges):
+            if not isinstance(bins, int) or bins <= 0:
+                raise ValueError("Error: 'nbr_bins' must be positive integers")
+            if lower >= upper:
+                raise ValueError("Error: histogram ranges must be (min, max) with min < max")
+
+        return {"axes": list(axes), "nbr_bins": list(nbr_bins), "ranges": [list(r) for r in ranges]}
+
+
+    def to_dict(self):
+        return {"name": self.name,
+                "type": ReducedDiagnostics.type,
+                "quantity": self.quantity,
+                "write_timestamps": self.write_timestamps,
+                "compute_timestamps": self.compute_timestamps,
+                "path": self.path,
+                "population_name": self.population_name,
+                "histogram": self.histogram}
@@ -96,13 +96,21 @@ class MaxwellianFluidModel(object):
         vbulk       : bulk velocity, tuple of size 3  (default = (0,0,0))
         beta        : beta of the species, float (default = 1)
         anisotropy  : Pperp/Ppara of the species, float (default = 1)
+        init        : particle loading options, dict (default = {})
+                      seed    : seed of the random draws, int (default = random)
+                      threads : threads loading the particles of a patch, int (default = 1)
+                      decomposition_independent : load the same particles whatever the
+                          number of MPI ranks and the patches of the levels,
+                          bool (default = False), unseeded runs share one seed on all ranks
         """
 
-        init_keys = ['seed']
+        init_keys = ['seed', 'threads', 'decomposition_independent']
         wrong_keys = phare_utilities.not_in_keywords_list(init_keys, **init)
         if len(wrong_keys) > 0:
             raise ValueError("Model Error: invalid init arguments - " + " ".join(wrong_keys))
         init["seed"] = init["seed"] if "seed" in init else None
+        if "threads" in init and int(init["threads"]) < 1:
+            raise ValueError("Model Error: init threads must be at least 1")
 
         density = self.defaulter(density, 1.)
 
@@ -0,0 +1,64 @@
+import numpy as np
+
+
+class Profile(object):
+    """
+    Analytic profile, usable in place of any init function of a model
+    (density, velocities, magnetic field...).
+
+    Profiles are evaluated in C++, without calling the interpreter, while
+    calling a profile from python evaluates the same function with numpy.
+
+    Profiles vary along one direction, given by axis ("x", "y" or "z").
+    """
+
+    names = ["uniform", "tanh", "harris"]
+
+    def __init__(self, name, axis="x", **parameters):
+        if name not in Profile.names:
+            raise ValueError("Error: unknown profile " + name)
+        if axis not in "xyz" or len(axis) != 1:
+            raise ValueError("Error: profile axis must be 'x', 'y' or 'z'")
+        if parameters.get("width", 1.) <= 0:
+            raise ValueError("Error: profile width must be positive")
+
+        self.name = name
+        self.axis = "xyz".index(axis)
+        self.parameters = {key: float(value) for key, value in parameters.items()}
+
+
+    def cpp_parameters(self):
+        return dict(self.parameters, axis=float(self.axis))
+
+
+    def __call__(self, *xyz):
+        x = np.asarray(xyz[self.axis], dtype=float)
+        p = self.parameters
+        background = p.get("background", 0.)
+        amplitude = p.get("amplitude", 1.)
+        center = p.get("center", 0.)
+        width = p.get("width", 1.)
+
+        if self.name == "uniform":
+            return p.get("value", 0.) + x * 0
+        if self.name == "tanh":
+            return background + amplitude * np.tanh((x - center) / width)
+        return background + amplitude / np.cosh((x - center) / width)**2
+
+
+
+def uniform(value):
+    """ constant profile """
+    return Profile("uniform", value=value)
+
+
+def tanh(amplitude=1., center=0., width=1., background=0., axis="x"):
+    """ background + amplitude * tanh((x - center) / width) """
+    return Profile("tanh", axis=axis, amplitude=amplitude, center=center,
+                   width=width, background=background)
+
+
+def harris(amplitude=1., center=0., width=1., background=0., axis="x"):
+    """ background + amplitude / cosh((x - center) / width)**2, e.g. a Harris sheet density """
+    return Profile("harris", axis=axis, amplitude=amplitude, center=center,
+                   width=width, background=background)
@@ -0,0 +1,164 @@
+"""
+Writes the simulation dict of a job to a file, once, so that PHARE reads it on all ranks
+without starting python (see initializer/serialized_data_provider.h):
+
+    python3 -m pyphare.pharein.serialize job.py job.phd
+    mpirun -n 4096 phare-exe job.phd
+
+The file is the list of the entries populateDict adds to the dict.
+Init functions must be analytic profiles (pyphare.pharein.profiles),
+python functions cannot be serialized.
+"""
+
+import struct
+import numbers
+import functools
+
+MAGIC = b"PHAREDICT"
+VERSION = 1
+INT, DOUBLE, STRING, SIZE_T, OPTIONAL_SIZE_T, VECTOR_DOUBLE, PROFILE = range(7)
+
+
+def _string(value):
+    data = value.encode()
+    return struct.pack("<I", len(data)) + data
+
+
+
+class DictWriter(object):
+    """
+    records the entries populateDict adds, with the functions of the C++ dict module
+    """
+
+    def __init__(self):
+        self.entries = []
+        for dim in [1, 2, 3]:
+            setattr(self, "addInitFunction{}D".format(dim), self._python_function)
+            setattr(self, "addProfile{}D".format(dim), functools.partial(self._profile, dim))
+
+
+    def _entry(self, kind, path, value):
+        self.entries.append(struct.pack("<B", kind) + _string(path) + value)
+
+
+    def add(self, path, value):
+        if isinstance(value, str):
+            self._entry(STRING, path, _string(value))
+        elif isinstance(value, numbers.Integral):
+            self._entry(INT, path, struct.pack("<q", int(value)))
+        elif isinstance(value, numbers.Real):
+            self._entry(DOUBLE, path, struct.pack("<d", float(value)))
+        else:
+            raise TypeError("Error: cannot serialize {} of type {}".format(path, type(value)))
+
+
+    def add_size_t(self, path, value):
+        self._entry(SIZE_T, path, struct.pack("<Q", value))
+
+
+    def add_optional_size_t(self, path, value):
+        self._entry(OPTIONAL_SIZE_T, path, struct.pack("<BQ", value is not None, value or 0))
+
+
+    def add_array_as_vector(self, path, array):
+        values = [float(value) for value in array]
+        fmt = "<Q{}d".format(len(values))
+        self._entry(VECTOR_DOUBLE, path, struct.pack(fmt, len(values), *values))
+
+
+    def _profile(self, dim, path, name, parameters):
+        value = struct.pack("<B", dim) + _string(name) + struct.pack("<I", len(parameters))
+        for key, parameter in parameters.items():
+            value += _string(key) + struct.pack("<d", parameter)
+        self._entry(PROFILE, path, value)
+
+
+    def _python_function(self, path, fn):
+        raise ValueError("Error: {} is a python function, which cannot be serialized,"
+                         " use pyphare.pharein.profiles".format(path))
+
+
+    def write(self, filename):
+        with open(filename, "wb") as f:
+            f.write(MAGIC + struct.pack("<I", VERSION))
+            for entry in self.entries:
+                f.write(entry)
+
+
+
+def serialize(filename):
+    """ writes the dict of the current simulation to filename """
+    from . import populateDict
+
+    writer = DictWriter()
+    populateDict(writer)
+    writer.write(filename)
+
+
+
+def read(filename):
+    """ returns the list of (path, value) serialized in filename, profiles as (name, parameters) """
+    with open(filename, "rb") as f:
+        data = f.read()
+
+    if data[:len(MAGIC)] != MAGIC:
+        raise ValueError("Error: {} is not a serialized PHARE dict".format(filename))
+    pos = len(MAGIC) + 4
+
+    def unpack(fmt):
+        nonlocal pos
+        values = struct.unpack_from(fmt, data, pos)
+        pos += struct.calcsize(fmt)
+        return values
+
+    def string():
+        nonlocal pos
+        size, = unpack("<I")
+        pos += size
+        return data[pos - size:pos].decode()
+
+    entries = []
+    while pos < len(data):
+        kind, = unpack("<B")
+        path = string()
+        if kind == INT:
+            value, = unpack("<q")
+        elif kind == DOUBLE:
+            value, = unpack("<d")
+        elif kind == STRING:
+            value = string()
+        elif kind == SIZE_T:
+            value, = unpack("<Q")
+        elif kind == OPTIONAL_SIZE_T:
+            has_value, value = unpack("<BQ")
+            value = value if has_value else None
+        elif kind == VECTOR_DOUBLE:
+            size, = unpack("<Q")
+            value = list(unpack("<{}d".format(size)))
+        elif kind == PROFILE:
+            _, = unpack("<B")
+            name = string()
+            size, = unpack("<I")
+            value = (name, {string(): unpack("<d")[0] for i in range(size)})
+        else:
+            raise ValueError("Error: unknown entry type for " + path)
+        entries.append((path, value))
+    return entries
+
+
+
+if __name__ == "__main__":
+    import sys
+    import importlib.util
+
+    if len(sys.argv) != 3:
+        print("usage: python3 -m pyphare.pharein.serialize job.py job.phd")
+        sys.exit(1)
+
+    # the job is loaded from its path, which needs not be importable as a module
+    spec = importlib.util.spec_from_file_location("phare_job", sys.argv[1])
+    if spec is None:
+        print("Error: cannot load job " + sys.argv[1])
+        sys.exit(1)
+    spec.loader.exec_module(importlib.util.module_from_spec(spec))
+    serialize(sys.argv[2])
@@ -332,7 +332,7 @@ def check_patch_size(**kwargs):
 
 # ------------------------------------------------------------------------------
 
-# diag_options = {"format":"phareh5", "options": {"dir": "phare_ouputs/"}}
+# diag_options = {"format":"phareh5", "options": {"dir": "phare_ouputs/", "max_in_flight_dumps": 1}}
 def check_diag_options(**kwargs):
     diag_options = kwargs.get("diag_options", None)
     formats = ["phareh5"]
@@ -349,17 +349,80 @@ def check_diag_options(**kwargs):
                     raise ValueError ("1. Creation of the directory %s failed" % diag_dir)
             except FileExistsError:
                 raise ValueError ("Creation of the directory %s failed" % diag_dir)
+    if diag_options is not None and "options" in diag_options:
+        if "max_in_flight_dumps" in diag_options["options"]:
+            max_in_flight = diag_options["options"]["max_in_flight_dumps"]
+            if not isinstance(max_in_flight, int) or max_in_flight < 0:
+                raise ValueError("Error - diag_options max_in_flight_dumps must be a positive integer")
+        if "dataset_layout" in diag_options["options"]:
+            if diag_options["options"]["dataset_layout"] not in ["patch", "level", "time_series"]:
+                raise ValueError("Error - diag_options dataset_layout must be 'patch', 'level' or 'time_series'")
     return diag_options
 
 
 
 
+# restart_options = {"dir": "checkpoints/", "timestamps": [10., 20.], "restart_time": 10.}
+def check_restart_options(**kwargs):
+    restart_options = kwargs.get("restart_options", None)
+    if restart_options is None:
+        return None
+
+    valid_keys = ["dir", "timestamps", "restart_time"]
+    wrong_keys = [key for key in restart_options if key not in valid_keys]
+    if len(wrong_keys) > 0:
+        raise ValueError("Error: invalid restart_options - " + " ".join(wrong_keys)
+                         + ", accepted are " + " ".join(valid_keys))
+
+    restart_dir = restart_options.get("dir", "phare_checkpoints")
+    if os.path.exists(restart_dir) and os.path.isfile(restart_dir):
+        raise ValueError("Error: Simulation restart_options dir exists as a file.")
+    os.makedirs(restart_dir, exist_ok=True)
+
+    timestamps = np.asarray(restart_options.get("timestamps", []), dtype=np.float64)
+    if (timestamps < 0).any():
+        raise ValueError("Error: restart_options timestamps cannot be negative")
+
+    options = {"dir": restart_dir, "timestamps": np.sort(timestamps)}
+    if "restart_time" in restart_options:
+        restart_time = float(restart_options["restart_time"])
+        if restart_time < 0:
+            raise ValueError(f"Error: restart_time ({restart_time}) cannot be negative")
+        options["restart_time"] = restart_time
+    return options
+
+
 
 def check_refinement(**kwargs):
     return kwargs.get("refinement", "boxes")
 
 
 
+def check_tagging(**kwargs):
+    """
+    returns the thresholds of the refinement criteria used when refinement == "tagging"
+    and the number of coarse time steps between two regrids
+    """
+    accepted_criteria = ["grad_B", "current", "density_jump"]
+    thresholds = kwargs.get("tagging_thresholds", {"grad_B": 0.1})
+
+    wrong_criteria = [key for key in thresholds if key not in accepted_criteria]
+    if len(wrong_criteria) > 0:
+        raise ValueError("Error: invalid tagging criteria - " + " ".join(wrong_criteria)
+                         + ", accepted are " + " ".join(accepted_criteria))
+
+    for key, threshold in thresholds.items():
+        if threshold <= 0:
+            raise ValueError(f"Error: tagging threshold {key} ({threshold}) must be positive")
+
+    regrid_interval = kwargs.get("regrid_interval", 1)
+    if regrid_interval < 1:
+        raise ValueError(f"Error: regrid_interval ({regrid_interval}) must be >= 1")
+
+    return thresholds, regrid_interval
+
+
+
 def check_nesting_buffer(**kwargs):
     nesting_buffer = kwargs.get('nesting_buffer', 0)
 
@@ -386,11 +449,41 @@ def check_nesting_buffer(**kwargs):
 
 
 
+def check_rebalance_interval(**kwargs):
+    rebalance_interval = kwargs.get("rebalance_interval", 0)
+
+    if rebalance_interval < 0:
+        raise ValueError(f"Error: rebalance_interval({rebalance_interval}) cannot be negative")
+
+    return rebalance_interval
+
+
+
+def check_timers_interval(**kwargs):
+    timers_interval = kwargs.get("timers_interval", 0)
+
+    if timers_interval < 0:
+        raise ValueError(f"Error: timers_interval({timers_interval}) cannot be negative")
+
+    return timers_interval
+
+
+
+def check_level_init_threads(**kwargs):
+    level_init_threads = kwargs.get("level_init_threads", 1)
+
+    if level_init_threads < 1:
+        raise ValueError(f"Error: level_init_threads({level_init_threads}) must be at least 1")
+
+    return level_init_threads
+
+
+
 def check_optional_keywords(**kwargs):
     extra = []
 
     if check_refinement(**kwargs) != "boxes":
-        extra += ['max_nbr_levels']
+        extra += ['max_nbr_levels', 'tagging_thresholds', 'regrid_interval']
 
     return extra
 
@@ -403,7 +496,9 @@ def checker(func):
                              'time_step', 'time_step_nbr', 'layout', 'interp_order', 'origin',
                              'boundary_types', 'refined_particle_nbr', 'path', 'nesting_buffer',
                              'diag_export_format', 'refinement_boxes', 'refinement',
-                             'smallest_patch_size', 'largest_patch_size', "diag_options" ]
+                             'smallest_patch_size', 'largest_patch_size', "diag_options",
+                             'rebalance_interval', 'restart_options', 'level_init_threads',
+                             'timers_file', 'timers_interval', 'log_file' ]
 
         accepted_keywords += check_optional_keywords(**kwargs)
 
@@ -429,6 +524,7 @@ def checker(func):
 
         dims = compute_dimension(cells)
         kwargs["diag_options"] = check_diag_options(**kwargs)
+        kwargs["restart_options"] = check_restart_options(**kwargs)
 
         kwargs["boundary_types"] = check_boundaries(dims, **kwargs)
         kwargs["origin"] = check_origin(dims, **kwargs)
@@ -442,6 +538,11 @@ def checker(func):
         kwargs["largest_patch_size"] = largest
 
         kwargs["nesting_buffer"] = check_nesting_buffer(**kwargs)
+        kwargs["rebalance_interval"] = check_rebalance_interval(**kwargs)
+        kwargs["level_init_threads"] = check_level_init_threads(**kwargs)
+        kwargs["timers_file"] = kwargs.get("timers_file", "phare_timers.txt")
+        kwargs["timers_interval"] = check_timers_interval(**kwargs)
+        kwargs["log_file"] = kwargs.get("log_file", None)
 
         kwargs["refinement"] = check_refinement(**kwargs)
         if kwargs["refinement"] == "boxes":
@@ -450,6 +551,7 @@ def checker(func):
             kwargs["max_nbr_levels"] = kwargs.get('max_nbr_levels', None)
             assert kwargs["max_nbr_levels"] != None # this needs setting otherwise
             kwargs["refinement_boxes"] = None
+            kwargs["tagging_thresholds"], kwargs["regrid_interval"] = check_tagging(**kwargs)
 
         return func(simulation_object, **kwargs)
 
@@ -486,6 +588,33 @@ class Simulation(object):
     smallest_patch_size  :
     largest_patch_size   :
     max_nbr_levels       : [default=1] max number of levels in the hierarchy if refinement_boxes != "boxes"
+    refinement           : [default="boxes"] "boxes" for user refinement_boxes, "tagging" for automatic refinement
+    tagging_thresholds   : [default={"grad_B":0.1}] used if refinement == "tagging", a cell is refined if one criterion exceeds its threshold
+                           "grad_B": relative magnetic jump dx|grad B|/|B|, "current": dx|J|/|B| with dx the largest mesh size of the level,
+                           "density_jump": relative density jump dx|grad n|/n. All are relative, independent of the units
+    regrid_interval      : [default=1] number of coarse time steps between two regrids if refinement == "tagging"
+    rebalance_interval   : [default=0] number of coarse time steps between two load balancings of the hierarchy,
+                           patches being weighted by their number of particles. 0 means only when regridding
+    level_init_threads   : [default=1] number of threads computing the moments of the patches of a new level
+    timers_file          : [default="phare_timers.txt"] file written at the end of the run, with the min, average and max
+                           time over the MPI ranks of each phase per level, if PHARE is configured with -DPHARE_TIMERS=1
+    timers_interval      : [default=0] number of coarse time steps between two writes of the timers so far to timers_file,
+                           0 means only at the end of the run
+    log_file             : [default=None] file the run log is appended to, one JSON object per line written by rank 0,
+                           instead of the standard output, if PHARE is configured with -DPHARE_LOG_LEVEL=1 or more
+    diag_options         : [default=None] {"format":"phareh5", "options": {"dir": "phare_outputs/", ...}}
+                           "max_in_flight_dumps": [default=0] if > 0, diagnostics are written by a dedicated I/O thread
+                           while the simulation advances, with at most that many dumps waiting to be written.
+                           Serial HDF5 only, dumps are synchronous with parallel HDF5
+                           "dataset_layout": [default="patch"] "patch" writes one dataset per patch and quantity,
+                           "level" one dataset per level and quantity, with a table of patch offsets,
+                           which scales better with the number of MPI ranks,
+                           "time_series" appends each dump of electromag and fluid diagnostics to one dataset
+                           per patch and quantity, with a "timestamps" dataset, for runs where the hierarchy does not change
+    restart_options      : [default=None] {"dir": "phare_checkpoints/", "timestamps": [...], "restart_time": t}
+                           a checkpoint of the whole hierarchy is written in "dir" at the time step closest to each of "timestamps",
+                           if "restart_time" is given, the simulation restarts from the checkpoint written at that time,
+                           possibly on a different number of MPI ranks, and diagnostics are only written after it
 
     """
 
@@ -11,6 +11,34 @@ import seaborn as sns
 from ..core.phare_utilities import np_array_ify, is_scalar
 
 
+class LazyData:
+    """
+    data read from a file only when first accessed, see PatchData.dataset
+    :param read: function taking no argument and returning the data
+    """
+    def __init__(self, read):
+        self.read = read
+
+
+
+def read_dataset(h5_dataset, selection=slice(None)):
+    """
+    returns the selection of an h5py dataset. Only contiguous datasets, which are neither
+    chunked nor compressed, are memory-mapped, so that only the pages actually used are read,
+    and can be released by the system, instead of copying the whole selection in memory.
+    Chunked datasets, which compressed datasets and the extendible datasets of the "time_series"
+    layout always are, cannot be mapped: h5py reads the selection, only the chunks it covers
+    """
+    if h5_dataset.chunks is None and h5_dataset.size > 0:
+        offset = h5_dataset.id.get_offset()
+        if offset is not None:
+            mapped = np.memmap(h5_dataset.file.filename, dtype=h5_dataset.dtype, mode="r",
+                               offset=offset, shape=h5_dataset.shape)
+            return mapped[selection]
+    return h5_dataset[selection]
+
+
+
 class PatchData:
     """
     base class for FieldData and ParticleData
@@ -26,6 +54,20 @@ class PatchData:
         self.box      = layout.box
         self.origin   = layout.origin
         self.layout   = layout
+        self._dataset = None
+
+    @property
+    def dataset(self):
+        """
+        data of the patch, LazyData is only read on first access
+        """
+        if isinstance(self._dataset, LazyData):
+            self._dataset = self._dataset.read()
+        return self._dataset
+
+    @dataset.setter
+    def dataset(self, data):
+        self._dataset = data
 
 
 
@@ -460,24 +502,60 @@ def pop_name(basename):
     return basename.strip(".h5").split("_")[-2]
 
 
-def add_to_patchdata(patch_datas, h5_patch_grp, basename, layout):
+def lazy_dataset(h5_patch_grp, dataset_name):
+    """
+    returns the LazyData of a dataset of a patch, whatever the dataset layout
+    """
+    if hasattr(h5_patch_grp, "lazy"):
+        return h5_patch_grp.lazy(dataset_name)
+    h5_dataset = h5_patch_grp[dataset_name]
+    return LazyData(lambda: read_dataset(h5_dataset))
+
+
+
+def lazy_particles(h5_patch_grp, layout):
+    """
+    returns the LazyData of the particles of a patch, all their datasets are only read
+    (or memory-mapped) when the particles are first accessed
+    """
+    datasets = {key: lazy_dataset(h5_patch_grp, key)
+                for key in ["iCell", "delta", "v", "weight", "charge"]}
+
+    def read():
+        data = {key: lazy.read() for key, lazy in datasets.items()}
+        return Particles(icells=data["iCell"],
+                         deltas=data["delta"],
+                         v=data["v"].reshape(data["v"].size // 3, 3),
+                         weights=data["weight"],
+                         charges=data["charge"],
+                         dl=np_array_ify(layout.dl))
+
+    return LazyData(read)
+
+
+
+def add_to_patchdata(patch_datas, h5_patch_grp, basename, layout, lazy=False):
     """
     adds data in the h5_patch_grp in the given PatchData dict
     returns True if valid h5 patch found
+    if lazy, patch datas hold LazyData, read on first access
     """
 
     if is_particle_file(basename):
 
-        v = np.asarray(h5_patch_grp["v"])
-        s = v.size
-        v = v[:].reshape(int(s / 3), 3)
+        if lazy:
+            particles = lazy_particles(h5_patch_grp, layout)
+        else:
+            v = np.asarray(h5_patch_grp["v"])
+            s = v.size
+            v = v[:].reshape(int(s / 3), 3)
 
-        particles = Particles(icells=h5_patch_grp["iCell"],
-                              deltas=h5_patch_grp["delta"],
-                              v=v,
-                              weights=h5_patch_grp["weight"],
-                              charges=h5_patch_grp["charge"],
-                              dl=np_array_ify(layout.dl))
+            particles = Particles(icells=h5_patch_grp["iCell"],
+                                  deltas=h5_patch_grp["delta"],
+                                  v=v,
+                                  weights=h5_patch_grp["weight"],
+                                  charges=h5_patch_grp["charge"],
+                                  dl=np_array_ify(layout.dl))
 
         pdname = particle_dataset_name(basename)
         if pdname in patch_datas:
@@ -488,7 +566,10 @@ def add_to_patchdata(patch_datas, h5_patch_grp, basename, layout):
     else:
         for dataset_name in h5_patch_grp.keys():
 
-            dataset = h5_patch_grp[dataset_name]
+            if lazy:
+                dataset = lazy_dataset(h5_patch_grp, dataset_name)
+            else:
+                dataset = h5_patch_grp[dataset_name]
 
             if dataset_name not in field_qties:
                 raise RuntimeError(
@@ -513,12 +594,157 @@ def patch_has_datasets(h5_patch_grp):
     return len(h5_patch_grp.keys())>0
 
 
-def hierarchy_fromh5(h5_filename, time, hier, silent=True):
+
+class LevelDatasetsPatch:
+    """
+    one patch of a level written with the "level" dataset layout, where each quantity
+    is a single dataset for the whole level, indexed by the tables in "patches" and "offsets".
+    Has the interface of an h5py patch group used here : attrs, keys() and [dataset_name]
+    """
+
+    def __init__(self, h5_lvl_grp, ipatch, dim):
+        self.h5_lvl_grp = h5_lvl_grp
+        self.ipatch = ipatch
+
+        patches = h5_lvl_grp["patches"]
+        dims = slice(ipatch * dim, (ipatch + 1) * dim)
+        lower = patches["lower"][dims]
+        upper = patches["upper"][dims]
+        self.attrs = {"lower": lower,
+                      "upper": upper,
+                      "origin": patches["origin"][dims],
+                      "nbrCells": upper - lower + 1}
+
+    def _offset_and_size(self, dataset_name):
+        offsets = self.h5_lvl_grp["offsets"][dataset_name]
+        return offsets[2 * self.ipatch], offsets[2 * self.ipatch + 1]
+
+    def keys(self):
+        return [name for name in self.h5_lvl_grp["offsets"].keys()
+                if self._offset_and_size(name)[1] > 0]
+
+    def __getitem__(self, dataset_name):
+        offset, size = self._offset_and_size(dataset_name)
+        return self.h5_lvl_grp[dataset_name][offset:offset + size]
+
+    def lazy(self, dataset_name):
+        offset, size = self._offset_and_size(dataset_name)
+        h5_dataset = self.h5_lvl_grp[dataset_name]
+        return LazyData(lambda: read_dataset(h5_dataset, slice(offset, offset + size)))
+
+
+
+def is_level_datasets_layout(h5_lvl_grp):
+    return "patches" in h5_lvl_grp.keys()
+
+
+
+def patch_groups(h5_lvl_grp, dim):
+    """
+    returns the (key, patch group) pairs of a level, whatever the dataset layout
+    """
+    if is_level_datasets_layout(h5_lvl_grp):
+        nbr_patches = h5_lvl_grp["patches"]["lower"].size // dim
+        return [("p{}".format(ipatch), LevelDatasetsPatch(h5_lvl_grp, ipatch, dim))
+                for ipatch in range(nbr_patches)]
+    return [(pkey, h5_lvl_grp[pkey]) for pkey in h5_lvl_grp.keys()]
+
+
+
+def is_selected_level(ilvl, levels):
+    return levels is None or ilvl in levels
+
+
+
+def selected_patch_groups(h5_lvl_grp, ilvl, dim, box):
+    """
+    returns the patch_groups of a level with datasets, which intersect box if given.
+    box is in AMR cell indexes of level 0, patch boxes are only read from their attributes
+    """
+    lvl_box = None if box is None else boxm.refine(box, 2 ** ilvl)
+
+    def selected(h5_patch_grp):
+        if not patch_has_datasets(h5_patch_grp):
+            return False
+        if lvl_box is None:
+            return True
+        patch_box = Box(h5_patch_grp.attrs["lower"], h5_patch_grp.attrs["upper"])
+        return patch_box * lvl_box is not None
+
+    return [(pkey, grp) for pkey, grp in patch_groups(h5_lvl_grp, dim) if selected(grp)]
+
+
+class TimeSeriesPatch:
+    """
+    one patch at one time of a file written with the "time_series" dataset layout, where
+    each dataset of a patch holds one row per dump. Has the interface of an h5py patch group
+    used here : attrs, keys() and [dataset_name], which reads only the row of its time
+    """
+
+    def __init__(self, h5_patch_grp, row):
+        self.h5_patch_grp = h5_patch_grp
+        self.row = row
+        self.attrs = h5_patch_grp.attrs
+
+    def keys(self):
+        return self.h5_patch_grp.keys()
+
+    def __getitem__(self, dataset_name):
+        return self.h5_patch_grp[dataset_name][self.row]
+
+    def lazy(self, dataset_name):
+        h5_dataset, row = self.h5_patch_grp[dataset_name], self.row
+        return LazyData(lambda: read_dataset(h5_dataset, row))
+
+
+
+class TimeSeriesFile:
+    """
+    view of a file written with the "time_series" dataset layout with the interface of a file
+    written with one group per time, "t#" keys giving the levels of the file at each timestamp,
+    as the hierarchy is the same at all times
+    """
+
+    def __init__(self, data_file):
+        self.data_file = data_file
+        self.attrs = data_file.attrs
+        self.rows = {"t{:.6f}".format(t): row for row, t in enumerate(data_file["timestamps"])}
+
+    def keys(self):
+        return list(self.rows.keys())
+
+    def __getitem__(self, time):
+        row = self.rows[time]
+        return {lvl_key: {pkey: TimeSeriesPatch(h5_patch_grp, row)
+                          for pkey, h5_patch_grp in self.data_file[lvl_key].items()}
+                for lvl_key in self.data_file.keys() if lvl_key.startswith("pl")}
+
+
+
+def is_time_series_layout(data_file):
+    return "timestamps" in data_file.keys()
+
+
+
+def hierarchy_fromh5(h5_filename, time, hier, silent=True, lazy=False, levels=None, box=None):
+    """
+    lazy : patch datas only read their data when first accessed, memory-mapping
+           contiguous datasets, so that files larger than the memory can be opened.
+           Chunked datasets, i.e. compressed ones and all those of "time_series" files,
+           are read instead, only the selected patch or row, see read_dataset
+    levels : only these level numbers are loaded, all if None
+    box : only patches intersecting this Box of level 0 AMR cell indexes are loaded,
+          all if None. levels and box must be the same when adding to an existing hier
+    """
     import h5py
+    selection = dict(lazy=lazy, levels=levels, box=box)
     data_file = h5py.File(h5_filename, "r")
+    if is_time_series_layout(data_file):
+        data_file = TimeSeriesFile(data_file)
     basename = os.path.basename(h5_filename)
     root_cell_width = float(data_file.attrs["cell_width"])
     domain_box = Box(0, int(data_file.attrs["domain_box"]))
+    dim = int(data_file.attrs["dimension"])
 
     if create_from_all_times(time, hier):
         # first create from first time
@@ -526,10 +752,10 @@ def hierarchy_fromh5(h5_filename, time, hier, silent=True):
         if not silent:
             print("creating hierarchy from all times in file")
         times = list(data_file.keys())
-        hier = hierarchy_fromh5(h5_filename, time=times[0], hier=hier)
+        hier = hierarchy_fromh5(h5_filename, time=times[0], hier=hier, **selection)
         if len(times) > 1:
             for t in times[1:]:
-                hierarchy_fromh5(h5_filename, t, hier)
+                hierarchy_fromh5(h5_filename, t, hier, **selection)
         return hier
 
     if create_from_one_time(time, hier):
@@ -544,17 +770,17 @@ def hierarchy_fromh5(h5_filename, time, hier, silent=True):
 
             h5_patch_lvl_grp = h5_time_grp[plvl_key]
             ilvl = int(plvl_key[2:])
+            if not is_selected_level(ilvl, levels):
+                continue
             lvl_cell_width = root_cell_width / 2 ** ilvl
             patches = {}
 
-            for pkey in h5_patch_lvl_grp.keys():
-
-                h5_patch_grp = h5_patch_lvl_grp[pkey]
+            for pkey, h5_patch_grp in selected_patch_groups(h5_patch_lvl_grp, ilvl, dim, box):
 
                 if patch_has_datasets(h5_patch_grp):
                     patch_datas = {}
                     layout = make_layout(h5_patch_grp, lvl_cell_width)
-                    add_to_patchdata(patch_datas, h5_patch_grp, basename, layout)
+                    add_to_patchdata(patch_datas, h5_patch_grp, basename, layout, lazy)
 
                     if ilvl not in patches:
                         patches[ilvl] = []
@@ -586,16 +812,18 @@ def hierarchy_fromh5(h5_filename, time, hier, silent=True):
 
             for plvl_key in h5_time_grp.keys():
                 ilvl = int(plvl_key[2:])
+                if not is_selected_level(ilvl, levels):
+                    continue
                 lvl_cell_width = root_cell_width / 2 ** ilvl
+                h5_patch_grps = selected_patch_groups(h5_time_grp[plvl_key], ilvl, dim, box)
 
-                for ipatch, pkey in enumerate(h5_time_grp[plvl_key].keys()):
-                    h5_patch_grp = h5_time_grp[plvl_key][pkey]
+                for ipatch, (pkey, h5_patch_grp) in enumerate(h5_patch_grps):
 
                     if patch_has_datasets(h5_patch_grp):
                         hier_patch = patch_levels[ilvl].patches[ipatch]
-                        origin = float(h5_time_grp[plvl_key][pkey].attrs['origin'])
-                        upper = int(h5_time_grp[plvl_key][pkey].attrs['upper'])
-                        lower = int(h5_time_grp[plvl_key][pkey].attrs['lower'])
+                        origin = float(h5_patch_grp.attrs['origin'])
+                        upper = int(h5_patch_grp.attrs['upper'])
+                        lower = int(h5_patch_grp.attrs['lower'])
                         file_patch_box = Box(lower, upper)
 
                         assert file_patch_box == hier_patch.box
@@ -603,7 +831,8 @@ def hierarchy_fromh5(h5_filename, time, hier, silent=True):
                         assert abs(lvl_cell_width - hier_patch.dx) < 1e-6
 
                         layout = make_layout(h5_patch_grp, lvl_cell_width)
-                        add_to_patchdata(hier_patch.patch_datas, h5_patch_grp, basename, layout)
+                        add_to_patchdata(hier_patch.patch_datas, h5_patch_grp, basename, layout,
+                                         lazy)
 
             return hier
 
@@ -617,17 +846,19 @@ def hierarchy_fromh5(h5_filename, time, hier, silent=True):
 
         for plvl_key in h5_time_grp.keys():
             ilvl = int(plvl_key[2:])
+            if not is_selected_level(ilvl, levels):
+                continue
 
             lvl_cell_width = root_cell_width / 2 ** ilvl
             lvl_patches = []
+            h5_patch_grps = selected_patch_groups(h5_time_grp[plvl_key], ilvl, dim, box)
 
-            for ipatch, pkey in enumerate(h5_time_grp[plvl_key].keys()):
-                h5_patch_grp = h5_time_grp[plvl_key][pkey]
+            for ipatch, (pkey, h5_patch_grp) in enumerate(h5_patch_grps):
 
                 if patch_has_datasets(h5_patch_grp):
                     layout = make_layout(h5_patch_grp, lvl_cell_width)
                     patch_datas = {}
-                    add_to_patchdata(patch_datas, h5_patch_grp, basename, layout)
+                    add_to_patchdata(patch_datas, h5_patch_grp, basename, layout, lazy)
                     lvl_patches.append(Patch(patch_datas))
 
             patch_levels[ilvl] = PatchLevel(ilvl, lvl_patches)
@@ -639,7 +870,7 @@ def hierarchy_fromh5(h5_filename, time, hier, silent=True):
         if not silent:
             print("loading all times in existing hier")
         for time in data_file.keys():
-            hier = hierarchy_fromh5(h5_filename, time, hier)
+            hier = hierarchy_fromh5(h5_filename, time, hier, **selection)
 
         return hier
 
@@ -660,7 +891,7 @@ def quantidic(ilvl, wrangler):
              "flux_x": pl.getFx,
              "flux_y": pl.getFy,
              "flux_z": pl.getFz,
-             "particles":pl.getParticles}
+             "particles":pl.getParticleArrays}
 
 
 
@@ -679,7 +910,10 @@ def isFieldQty(qty):
 
 
 
-def hierarchy_from_sim(simulator, qty, pop=""):
+def hierarchy_from_sim(simulator, qty, pop="", box=None):
+    """
+    box : for particles, only the particles in this Box of level 0 AMR cell indexes are taken
+    """
     dw = simulator.data_wrangler()
     nbr_levels = dw.getNumberOfLevels()
     patch_levels = {}
@@ -703,7 +937,9 @@ def hierarchy_from_sim(simulator, qty, pop=""):
                 upper = int(patch.upper[0])
                 origin = float(patch.origin)
                 layout = GridLayout(Box(lower, upper), origin, lvl_cell_width, interp_order = simulator.interporder())
-                pdata = FieldData(layout, field_qties[qty], patch.data)
+                # the data is a view over the field of the simulation, copied so that the
+                # hierarchy keeps the values of the current time
+                pdata = FieldData(layout, field_qties[qty], np.array(patch.data))
                 patch_datas[qty] = pdata
                 patches[ilvl].append(Patch(patch_datas))
 
@@ -711,75 +947,49 @@ def hierarchy_from_sim(simulator, qty, pop=""):
 
             if pop=="":
                 raise ValueError("must specify pop argument for particles")
-            # here the getter returns a dict like this
-            # {'protons': {'patchGhost': [<pybindlibs.cpp.PatchDataContiguousParticles_1 at 0x119f78970>,
-            #<pybindlibs.cpp.PatchDataContiguousParticles_1 at 0x119f78f70>],
-            # 'domain': [<pybindlibs.cpp.PatchDataContiguousParticles_1 at 0x119f78d70>,
-            # <pybindlibs.cpp.PatchDataContiguousParticles_1 at 0x119f78770>]}}
 
+            # here the getter returns a dict like this
+            # {'domain': [<pybindlibs.cpp.PatchDataParticleArray_1 at 0x119f78970>, ...],
+            #  'patchGhost': [...]}
+            # where the data of each patch is a numpy array of the particles of the simulation
             # domain particles are assumed to always be here
             # but patchGhost and levelGhost may not be, depending on the level
 
-            populationdict = getters[qty](pop)[pop]
-
-
-            dom_dw_patches = populationdict["domain"]
-            for patch in dom_dw_patches:
-                patch_datas= {}
-
+            if box is None:
+                arrays = getters[qty](pop)
+            else:
+                lvl_box = boxm.refine(box, 2 ** ilvl)
+                arrays = getters[qty](pop, lvl_box.lower.tolist(), lvl_box.upper.tolist())
+            dl = np_array_ify(lvl_cell_width)
+
+            # the arrays are views over the particle storage of the simulation, which is
+            # reallocated as it advances, the hierarchy keeps a copy
+            def particles_from(view):
+                array = np.array(view)
+                return Particles(icells=array["iCell"],
+                                 deltas=array["delta"],
+                                 v=array["v"],
+                                 weights=array["weight"],
+                                 charges=array["charge"],
+                                 dl=dl)
+
+            for patch in arrays.get("domain", []):
                 lower = int(patch.lower[0])
                 upper = int(patch.upper[0])
                 origin = float(patch.origin)
                 layout = GridLayout(Box(lower, upper), origin, lvl_cell_width, interp_order=simulator.interp_order())
-
-                v = np.asarray(patch.data.v).reshape(int(len(patch.data.v) / 3), 3)
-
-                domain_particles = Particles(icells = np.asarray(patch.data.iCell),
-                                             deltas = np.asarray(patch.data.delta),
-                                             v      = v,
-                                             weights = np.asarray(patch.data.weight),
-                                             charges = np.asarray(patch.data.charge))
-
-                patch_datas[pop +"_particles"] = ParticleData(layout, domain_particles, pop)
+                patch_datas = {pop +"_particles": ParticleData(layout, particles_from(patch.data), pop)}
                 patches[ilvl].append(Patch(patch_datas))
 
-
-
-            # ok now let's add the patchGhost if present
-            # note that patchGhost patches may not be the same list as the
-            # domain patches... since not all patches may not have patchGhost while they do have
-            # domain... while looping on the patchGhost items, we need to search in
-            # the already created patches which one to which add the patchGhost particles
-
+            # ghost particles are added to the particles of the patch having the same box
+            # patches with ghost particles may not have domain particles in the selected box
 
             for ghostParticles in ["patchGhost", "levelGhost"]:
-                if ghostParticles in populationdict:
-                    for dwpatch in populationdict[ghostParticles]:
-
-                        v = np.asarray(dwpatch.data.v)
-                        s = v.size
-                        v = v[:].reshape(int(s / 3), 3)
-
-
-                        patchGhost_part = Particles(icells=np.asarray(dwpatch.data.iCell),
-                                                     deltas=np.asarray(dwpatch.data.delta),
-                                                     v= v,
-                                                     weights=np.asarray(dwpatch.data.weight),
-                                                     charges=np.asarray(dwpatch.data.charge))
-
-                        lower = int(dwpatch.lower[0])
-                        upper = int(dwpatch.upper[0])
-
-                        box = Box(lower, upper)
-
-                        # now search which of the already created patches has the same box
-                        # once found we add the new particles to the ones already present
-
-                        patch = [p for p in patches[ilvl] if p.box == box][0]
-                        patch.patch_datas[pop+"_particles"].dataset.add(patchGhost_part)
-
-
-
+                for dwpatch in arrays.get(ghostParticles, []):
+                    patch_box = Box(int(dwpatch.lower[0]), int(dwpatch.upper[0]))
+                    matches = [p for p in patches[ilvl] if p.box == patch_box]
+                    if len(matches):
+                        matches[0].patch_datas[pop+"_particles"].dataset.add(particles_from(dwpatch.data))
 
 
 
@@ -800,7 +1010,8 @@ def hierarchy_from_sim(simulator, qty, pop=""):
 
 
 
-def hierarchy_from(simulator=None, qty= None, pop = "", h5_filename=None, time=None, hier=None):
+def hierarchy_from(simulator=None, qty= None, pop = "", h5_filename=None, time=None, hier=None,
+                   lazy=False, levels=None, box=None):
     """
     this function reads an HDF5 PHARE file and returns a PatchHierarchy from
     which data is accessible.
@@ -808,6 +1019,7 @@ def hierarchy_from(simulator=None, qty= None, pop = "", h5_filename=None, time=N
     then only that time will be read
     if 'hier' is None, then a new hierarchy will be created, if not then the
     given hierarchy 'hier' will be filled.
+    'lazy', 'levels' and 'box' select what is read from the file, see hierarchy_fromh5
 
     The function fails if the data is already in hierarchy
     """
@@ -816,10 +1028,10 @@ def hierarchy_from(simulator=None, qty= None, pop = "", h5_filename=None, time=N
         raise ValueError("cannot pass both a simulator and a h5 file")
 
     if h5_filename is not None:
-        return hierarchy_fromh5(h5_filename, time, hier)
+        return hierarchy_fromh5(h5_filename, time, hier, lazy=lazy, levels=levels, box=box)
 
     if simulator is not None and qty is not None:
-        return hierarchy_from_sim(simulator, qty, pop=pop)
+        return hierarchy_from_sim(simulator, qty, pop=pop, box=box)
 
     print(h5_filename)
     raise ValueError("can't make hierarchy")
@@ -57,7 +57,8 @@ class Simulator:
             )
 
             self.cpp_sim.initialize()
-            self._auto_dump() # first dump might be before first advance
+            if self.cpp_sim.startTime() == 0: # restarts were dumped at their start time already
+                self._auto_dump() # first dump might be before first advance
             return self
         except:
             import sys
@@ -81,7 +82,7 @@ class Simulator:
         self._check_init()
         perf = []
         end_time = self.cpp_sim.endTime()
-        t = 0.
+        t = self.cpp_sim.currentTime()
         while t < end_time:
             tick  = timem.time()
             self.advance()
@@ -91,6 +92,8 @@ class Simulator:
             t = self.cpp_sim.currentTime()
             print("t = {:8.5f}  -  {:6.5f}sec  - total {:7.4}sec".format(t, ticktock, np.sum(perf)))
 
+        self.flush()
+
         print("mean advance time = {}".format(np.mean(perf)))
         print("total advance time = {}".format(np.sum(perf)))
 
@@ -110,6 +113,16 @@ class Simulator:
             self.cpp_sim.dump(timestamp=args[0], timestep=args[1])
         return self
 
+    def flush(self):
+        """
+        waits for the diagnostics still being written asynchronously, raising their errors, and
+        writes the timers. run() flushes at its end, runs advanced step by step should flush once
+        over, on all MPI ranks
+        """
+        self._check_init()
+        self.cpp_sim.flush()
+        return self
+
     def data_wrangler(self):
         self._check_init()
         if self.cpp_dw is None:
@@ -0,0 +1,60 @@
+
+import os
+import tempfile
+import unittest
+
+import pyphare.pharein.global_vars as global_vars
+
+from pyphare.pharein import Simulation, MaxwellianFluidModel, ElectronModel
+from pyphare.pharein import profiles, serialize
+
+
+class TestSerialize(unittest.TestCase):
+
+    def setUp(self):
+        global_vars.sim = None
+
+    def tearDown(self):
+        global_vars.sim = None
+
+    def simulation(self, density):
+        Simulation(time_step_nbr=1000, final_time=1., boundary_types="periodic",
+                   cells=65, dl=1./65)
+        uniform = profiles.uniform(1.)
+        MaxwellianFluidModel(bx=uniform, by=profiles.uniform(0.), bz=profiles.uniform(0.),
+                             protons={"density": density, "vbulkx": uniform, "vbulky": uniform,
+                                      "vbulkz": uniform, "vthx": uniform, "vthy": uniform,
+                                      "vthz": uniform, "init": {"seed": 1337}})
+        ElectronModel(closure="isothermal", Te=0.12)
+
+
+    def test_profiles_are_serialized(self):
+        self.simulation(profiles.harris(amplitude=2., center=.5, width=.1, background=.2))
+
+        with tempfile.TemporaryDirectory() as tmp:
+            filename = os.path.join(tmp, "job.phd")
+            serialize.serialize(filename)
+            entries = dict(serialize.read(filename))
+
+        self.assertEqual(entries["simulation/dimension"], 1)
+        self.assertEqual(entries["simulation/grid/nbr_cells/x"], 65)
+        self.assertAlmostEqual(entries["simulation/time_step"], 0.001)
+        self.assertEqual(entries["simulation/ions/pop0/particle_initializer/init/seed"], 1337)
+
+        name, parameters = entries["simulation/ions/pop0/particle_initializer/density"]
+        self.assertEqual(name, "harris")
+        self.assertEqual(parameters, {"amplitude": 2., "center": .5, "width": .1,
+                                      "background": .2, "axis": 0.})
+
+
+    def test_python_functions_are_not_serialized(self):
+        self.simulation(lambda x: 1. + x * 0)
+
+        with tempfile.TemporaryDirectory() as tmp:
+            with self.assertRaises(ValueError):
+                serialize.serialize(os.path.join(tmp, "job.phd"))
+
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,190 @@
+import os
+import tempfile
+import unittest
+
+import h5py
+import numpy as np
+from ddt import ddt, data
+
+from pyphare.core.box import Box
+from pyphare.pharesee.hierarchy import hierarchy_fromh5, LazyData
+
+
+time = "t{:.6f}".format(0.)
+cell_width = 0.1
+
+# AMR boxes of the patches of each level, level 1 being refined from cells 4 to 11 of level 0
+patch_boxes = {0: [(0, 9), (10, 19)], 1: [(8, 15), (16, 23)]}
+
+# layout, options of the field datasets
+layouts = {"patch": {}, "patch_compressed": {"compression": "gzip", "chunks": True},
+           "level": {}, "time_series": {}}
+
+
+
+def field_values(ilvl, ipatch):
+    lower, upper = patch_boxes[ilvl][ipatch]
+    return 1000. * ilvl + 100. * ipatch + np.arange(upper - lower + 4, dtype=np.float64)
+
+
+def particle_values(ilvl, ipatch):
+    lower, upper = patch_boxes[ilvl][ipatch]
+    icells = np.arange(lower, upper + 1, dtype=np.int32)
+    nbr = icells.size
+    return {"iCell": icells,
+            "delta": np.full(nbr, .5, dtype=np.float32),
+            "v": np.arange(3 * nbr, dtype=np.float64) + 1000. * ilvl + 100. * ipatch,
+            "weight": np.full(nbr, 1. + ilvl, dtype=np.float64),
+            "charge": np.ones(nbr, dtype=np.float64)}
+
+
+def patch_attrs(h5_grp, ilvl, lower, upper):
+    h5_grp.attrs["lower"] = np.asarray([lower], dtype=np.int32)
+    h5_grp.attrs["upper"] = np.asarray([upper], dtype=np.int32)
+    h5_grp.attrs["origin"] = np.asarray([lower * cell_width / 2 ** ilvl])
+    h5_grp.attrs["nbrCells"] = np.asarray([upper - lower + 1], dtype=np.int32)
+
+
+def write_file(filename, layout, datasets):
+    """
+      writes the datasets, functions of the level and patch numbers returning a dict of arrays,
+      of the patches of patch_boxes, with the given dataset layout
+    """
+    options = layouts[layout]
+    with h5py.File(filename, "w") as h5:
+        h5.attrs["cell_width"] = cell_width
+        h5.attrs["domain_box"] = 19
+        h5.attrs["dimension"] = 1
+
+        if layout == "time_series":
+            h5.create_dataset("timestamps", data=[0.], maxshape=(None,), chunks=(64,))
+            for ilvl, boxes in patch_boxes.items():
+                for ipatch, (lower, upper) in enumerate(boxes):
+                    h5_patch_grp = h5.create_group("pl{}/p0#{}".format(ilvl, ipatch))
+                    patch_attrs(h5_patch_grp, ilvl, lower, upper)
+                    for name, values in datasets(ilvl, ipatch).items():
+                        h5_patch_grp.create_dataset(name, data=values[np.newaxis, :],
+                                                    maxshape=(None, values.size),
+                                                    chunks=(1, values.size))
+            return
+
+        for ilvl, boxes in patch_boxes.items():
+            h5_lvl_grp = h5.create_group("{}/pl{}".format(time, ilvl))
+
+            if layout == "level":
+                h5_lvl_grp["patches/lower"] = np.asarray([box[0] for box in boxes], dtype=np.int32)
+                h5_lvl_grp["patches/upper"] = np.asarray([box[1] for box in boxes], dtype=np.int32)
+                h5_lvl_grp["patches/origin"] = [box[0] * cell_width / 2 ** ilvl for box in boxes]
+                patches = [datasets(ilvl, ipatch) for ipatch in range(len(boxes))]
+                for name in patches[0]:
+                    values = [patch[name] for patch in patches]
+                    sizes = [v.size for v in values]
+                    offsets = np.cumsum([0] + sizes[:-1])
+                    h5_lvl_grp[name] = np.concatenate(values)
+                    h5_lvl_grp["offsets/" + name] = np.ravel(np.column_stack((offsets, sizes)))
+                continue
+
+            for ipatch, (lower, upper) in enumerate(boxes):
+                h5_patch_grp = h5_lvl_grp.create_group("p0#{}".format(ipatch))
+                patch_attrs(h5_patch_grp, ilvl, lower, upper)
+                for name, values in datasets(ilvl, ipatch).items():
+                    h5_patch_grp.create_dataset(name, data=values, **options)
+
+
+
+@ddt
+class HierarchyLoadingTest(unittest.TestCase):
+
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+
+    def tearDown(self):
+        self.tmp.cleanup()
+
+
+    # files are written once per test, hierarchies keep them open
+    def field_file(self, layout):
+        filename = os.path.join(self.tmp.name, "EM_B.h5")
+        write_file(filename, layout, lambda ilvl, ipatch: {"EM_B_x": field_values(ilvl, ipatch)})
+        return filename
+
+
+    def particle_file(self, layout):
+        filename = os.path.join(self.tmp.name, "ions_pop_protons_domain.h5")
+        write_file(filename, layout, particle_values)
+        return filename
+
+
+    def patch_index(self, ilvl, patch):
+        return patch_boxes[ilvl].index((patch.box.lower[0], patch.box.upper[0]))
+
+
+    def assertLoadedFields(self, hier, expected_patches):
+        levels = hier.levels(0.)
+        self.assertEqual(sorted(levels.keys()), sorted(expected_patches.keys()))
+        for ilvl, level in levels.items():
+            ipatches = [self.patch_index(ilvl, patch) for patch in level.patches]
+            self.assertEqual(sorted(ipatches), expected_patches[ilvl])
+            for ipatch, patch in zip(ipatches, level.patches):
+                np.testing.assert_array_equal(patch.patch_datas["EM_B_x"].dataset[:],
+                                              field_values(ilvl, ipatch))
+
+
+    @data(*layouts.keys())
+    def test_lazy_field_data_is_read_on_first_access(self, layout):
+        hier = hierarchy_fromh5(self.field_file(layout), time, None, lazy=True)
+        for level in hier.levels(0.).values():
+            for patch in level.patches:
+                self.assertIsInstance(patch.patch_datas["EM_B_x"]._dataset, LazyData)
+
+        self.assertLoadedFields(hier, {0: [0, 1], 1: [0, 1]})
+
+        # only contiguous datasets are memory-mapped, chunked ones are read
+        dataset = hier.level(0, 0.).patches[0].patch_datas["EM_B_x"].dataset
+        contiguous = layout in ["patch", "level"]
+        self.assertEqual(isinstance(dataset, np.memmap), contiguous)
+
+
+    @data(*layouts.keys())
+    def test_only_selected_levels_are_loaded(self, layout):
+        filename = self.field_file(layout)
+        for lazy in [False, True]:
+            hier = hierarchy_fromh5(filename, time, None, lazy=lazy, levels=[1])
+            self.assertLoadedFields(hier, {1: [0, 1]})
+
+
+    @data(*layouts.keys())
+    def test_only_patches_intersecting_the_box_are_loaded(self, layout):
+        filename = self.field_file(layout)
+        for lazy in [False, True]:
+            # cells 2 to 5 of level 0 are cells 4 to 11 of level 1
+            hier = hierarchy_fromh5(filename, time, None, lazy=lazy, box=Box(2, 5))
+            self.assertLoadedFields(hier, {0: [0], 1: [0]})
+
+            hier = hierarchy_fromh5(filename, time, None, lazy=lazy, levels=[1], box=Box(8, 15))
+            self.assertLoadedFields(hier, {1: [1]})
+
+
+    @data("patch", "level")
+    def test_lazy_particles_are_selected_and_read_on_first_access(self, layout):
+        # cells 7 to 8 of level 0 are cells 14 to 17 of level 1, held by both its patches
+        hier = hierarchy_fromh5(self.particle_file(layout), time, None, lazy=True,
+                                levels=[1], box=Box(7, 8))
+        level = hier.level(1, 0.)
+        self.assertEqual(len(level.patches), 2)
+
+        for patch in level.patches:
+            pdata = patch.patch_datas["protons_domain"]
+            self.assertIsInstance(pdata._dataset, LazyData)
+
+            expected = particle_values(1, self.patch_index(1, patch))
+            particles = pdata.dataset
+            np.testing.assert_array_equal(particles.iCells, expected["iCell"])
+            np.testing.assert_array_equal(particles.deltas, expected["delta"])
+            np.testing.assert_array_equal(particles.v, expected["v"].reshape(-1, 3))
+            np.testing.assert_array_equal(particles.weights, expected["weight"])
+
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -34,7 +34,8 @@ if (bench)
     add_executable(${target} ${file})
     target_compile_options(${target} PRIVATE ${PHARE_WERROR_FLAGS} -DPHARE_HAS_HIGHFIVE=${PHARE_HAS_HIGHFIVE})
     set_property(TARGET ${target} PROPERTY INTERPROCEDURAL_OPTIMIZATION ${PHARE_INTERPROCEDURAL_OPTIMIZATION})
-    target_include_directories(${target} PUBLIC ${PHARE_PROJECT_DIR}/subprojects/googlebench/include)
+    target_include_directories(${target} PUBLIC ${PHARE_PROJECT_DIR}/subprojects/googlebench/include
+                                                ${PHARE_PROJECT_DIR}/tools) # for bench/core/bench.h
     add_phare_test(${target} ${directory}) # using this function means benchmarks can be run with MPI, not sure this is good.
   endfunction(add_phare_cpp_benchmark_)
 
@@ -44,9 +45,17 @@ if (bench)
   endfunction(add_phare_cpp_benchmark)
 
 
+  add_subdirectory(tools/bench/core/data/ions)
   add_subdirectory(tools/bench/core/data/particles)
+  add_subdirectory(tools/bench/core/numerics/field_solvers)
+  add_subdirectory(tools/bench/core/numerics/interpolator)
   add_subdirectory(tools/bench/core/numerics/pusher)
 
+  add_subdirectory(tools/bench/amr/data/field)
+  add_subdirectory(tools/bench/amr/data/particles)
+
+  add_subdirectory(tools/bench/solver)
+
   add_subdirectory(tools/bench/hi5)
 
 endif()
@@ -2,6 +2,9 @@
 
 set (PHARE_FLAGS ${PHARE_FLAGS})
 set (PHARE_WERROR_FLAGS ${PHARE_FLAGS} ${PHARE_WERROR_FLAGS})
+add_definitions(-DPHARE_LOG_LEVEL=${PHARE_LOG_LEVEL}) # see src/core/logger.h
+add_definitions(-DPHARE_TIMERS=${PHARE_TIMERS}) # see src/core/timers.h
+
 set (PHARE_PYTHONPATH "${CMAKE_BINARY_DIR}:${CMAKE_SOURCE_DIR}/pyphare")
 
 # Link Time Optimisation flags - is disabled if coverage is enabled
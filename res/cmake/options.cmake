@@ -66,6 +66,16 @@ if (NOT DEFINED PHARE_EXEC_LEVEL_MAX)
   set(PHARE_EXEC_LEVEL_MAX 10)
 endif()
 
+# Run log verbosity, see src/core/logger.h
+if (NOT DEFINED PHARE_LOG_LEVEL)
+  set(PHARE_LOG_LEVEL 0)
+endif()
+
+# Timers and counters per level and phase, see src/core/timers.h
+if (NOT DEFINED PHARE_TIMERS)
+  set(PHARE_TIMERS 0)
+endif()
+
 # -Dbench=OFF
 option(bench "Compile PHARE Benchmarks" OFF)
 
@@ -87,6 +97,8 @@ function(print_phare_options)
   message("build with ubsan support                    : " ${ubsan})
   message("build with asan support                     : " ${asan})
   message("build with ubsan support                    : " ${ubsan})
+  message("PHARE_LOG_LEVEL                             : " ${PHARE_LOG_LEVEL})
+  message("PHARE_TIMERS                                : " ${PHARE_TIMERS})
 
   if(${devMode})
     message("PHARE_EXEC_LEVEL_MIN                        : " ${PHARE_EXEC_LEVEL_MIN})
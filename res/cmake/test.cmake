@@ -155,6 +155,7 @@ if (test AND ${PHARE_EXEC_LEVEL_MIN} GREATER 0) # 0 = no tests
   add_subdirectory(tests/core/numerics/faraday)
   add_subdirectory(tests/core/numerics/ohm)
   add_subdirectory(tests/core/numerics/ion_updater)
+  add_subdirectory(tests/core/numerics/tagging)
 
 
   add_subdirectory(tests/initializer)
@@ -166,6 +167,7 @@ if (test AND ${PHARE_EXEC_LEVEL_MIN} GREATER 0) # 0 = no tests
   add_subdirectory(tests/amr/data/field/geometry)
   add_subdirectory(tests/amr/data/field/overlap)
   add_subdirectory(tests/amr/data/field/refine)
+  add_subdirectory(tests/amr/data/field/ratio2)
   add_subdirectory(tests/amr/data/field/variable)
   add_subdirectory(tests/amr/data/field/time_interpolate)
   add_subdirectory(tests/amr/resources_manager)
@@ -5,6 +5,7 @@
 #include "amr/data/field/field_geometry.h"
 #include "field_coarsen_index_weight.h"
 #include "field_coarsener.h"
+#include "field_coarsener_ratio2.h"
 #include "core/utilities/constants.h"
 #include "core/utilities/point/point.h"
 
@@ -124,6 +125,16 @@ namespace amr
 
 
 
+            // the usual refinement ratio has its own kernel working on the whole box
+            if (ratio == SAMRAI::hier::IntVector{ratio.getDim(), 2})
+            {
+                FieldCoarsenerRatio2<dimension> coarsener{destinationLayout.centering(qty),
+                                                          sourceBox, destinationBox};
+                coarsener(sourceField, destinationField, intersectionBox);
+                return;
+            }
+
+
             // We can now create the coarsening operator
             FieldCoarsener<dimension> coarsener{destinationLayout.centering(qty), sourceBox,
                                                 destinationBox, ratio};
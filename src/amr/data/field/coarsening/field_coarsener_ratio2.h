@@ -0,0 +1,219 @@
+#ifndef PHARE_FIELD_COARSENER_RATIO2_H
+#define PHARE_FIELD_COARSENER_RATIO2_H
+
+#include "core/data/grid/gridlayoutdefs.h"
+#include "core/utilities/constants.h"
+
+#include "amr/data/field/field_centering.h"
+
+#include <SAMRAI/hier/Box.h>
+
+#include <array>
+#include <cstddef>
+
+
+
+namespace PHARE
+{
+namespace amr
+{
+    using core::dirX;
+    using core::dirY;
+    using core::dirZ;
+
+    /** @brief weights of the fine nodes averaged onto a coarse node for a refinement ratio of 2,
+     * they are the ones the CoarsenWeighter computes for 3 (primal) and 2 (dual) points. shift is
+     * the offset of the first fine node from 2 * coarseIndex
+     */
+    template<core::QtyCentering centering>
+    struct CoarsenRatio2Stencil;
+
+    template<>
+    struct CoarsenRatio2Stencil<core::QtyCentering::primal>
+    {
+        static constexpr int shift                     = -1;
+        static constexpr std::array<double, 3> weights = {{0.25, 0.5, 0.25}};
+    };
+
+    template<>
+    struct CoarsenRatio2Stencil<core::QtyCentering::dual>
+    {
+        static constexpr int shift                     = 0;
+        static constexpr std::array<double, 2> weights = {{0.5, 0.5}};
+    };
+
+
+
+
+    /** @brief FieldCoarsenerRatio2 coarsens a whole box of coarse nodes at once when the
+     * refinement ratio is 2 in all directions. It gives the same result as FieldCoarsener, but the
+     * weights are known at compile time for each centering, and nodes are traversed with strides
+     * on the underlying arrays, the innermost loop running on contiguous coarse nodes.
+     */
+    template<std::size_t dimension>
+    class FieldCoarsenerRatio2
+    {
+    public:
+        FieldCoarsenerRatio2(std::array<core::QtyCentering, dimension> const& centering,
+                             SAMRAI::hier::Box const& sourceBox,
+                             SAMRAI::hier::Box const& destinationBox)
+            : centering_{centering}
+            , sourceBox_{sourceBox}
+            , destinationBox_{destinationBox}
+        {
+        }
+
+
+        /** @brief coarsen fineField onto coarseField on all nodes of coarseBox, given in AMR
+         * field indexes. The fine field must hold enough ghost nodes for the stencil.
+         */
+        template<typename FieldT>
+        void operator()(FieldT const& fineField, FieldT& coarseField,
+                        SAMRAI::hier::Box const& coarseBox) const
+        {
+            TBOX_ASSERT(fineField.physicalQuantity() == coarseField.physicalQuantity());
+
+            if (coarseBox.empty())
+                return;
+
+            visitCenterings(centering_, [&](auto centeringTag) {
+                coarsen_(centeringTag, fineField, coarseField, coarseBox);
+            });
+        }
+
+
+
+    private:
+        template<core::QtyCentering cx, typename FieldT>
+        void coarsen_(CenteringTag<cx>, FieldT const& fineField, FieldT& coarseField,
+                      SAMRAI::hier::Box const& coarseBox) const
+        {
+            using SX = CoarsenRatio2Stencil<cx>;
+
+            double const* fine = fineField.data();
+            double* coarse     = &coarseField(coarseBox.lower(dirX) - destinationBox_.lower(dirX));
+
+            int const fineShiftX = SX::shift - sourceBox_.lower(dirX);
+
+            for (int ix = coarseBox.lower(dirX); ix <= coarseBox.upper(dirX); ++ix)
+            {
+                double const* fineX = fine + 2 * ix + fineShiftX;
+                double value        = 0.;
+
+                for (std::size_t iShiftX = 0; iShiftX < SX::weights.size(); ++iShiftX)
+                    value += SX::weights[iShiftX] * fineX[iShiftX];
+
+                *coarse++ = value;
+            }
+        }
+
+
+
+        template<core::QtyCentering cx, core::QtyCentering cy, typename FieldT>
+        void coarsen_(CenteringTag<cx, cy>, FieldT const& fineField, FieldT& coarseField,
+                      SAMRAI::hier::Box const& coarseBox) const
+        {
+            using SX = CoarsenRatio2Stencil<cx>;
+            using SY = CoarsenRatio2Stencil<cy>;
+
+            auto const fineStrideX = static_cast<int>(fineField.shape()[dirY]);
+
+            int const fineShiftX = SX::shift - sourceBox_.lower(dirX);
+            int const fineShiftY = SY::shift - sourceBox_.lower(dirY);
+
+            int const coarseLowerY = coarseBox.lower(dirY) - destinationBox_.lower(dirY);
+
+            for (int ix = coarseBox.lower(dirX); ix <= coarseBox.upper(dirX); ++ix)
+            {
+                double const* fineX = fineField.data() + (2 * ix + fineShiftX) * fineStrideX;
+                double* coarse = &coarseField(ix - destinationBox_.lower(dirX), coarseLowerY);
+
+                for (int iy = coarseBox.lower(dirY); iy <= coarseBox.upper(dirY); ++iy)
+                {
+                    double const* fineXY = fineX + 2 * iy + fineShiftY;
+                    double value         = 0.;
+
+                    for (std::size_t iShiftX = 0; iShiftX < SX::weights.size(); ++iShiftX)
+                    {
+                        double yValue = 0.;
+                        double const* fineRow = fineXY + iShiftX * fineStrideX;
+                        for (std::size_t iShiftY = 0; iShiftY < SY::weights.size(); ++iShiftY)
+                            yValue += SY::weights[iShiftY] * fineRow[iShiftY];
+
+                        value += SX::weights[iShiftX] * yValue;
+                    }
+
+                    *coarse++ = value;
+                }
+            }
+        }
+
+
+
+        template<core::QtyCentering cx, core::QtyCentering cy, core::QtyCentering cz,
+                 typename FieldT>
+        void coarsen_(CenteringTag<cx, cy, cz>, FieldT const& fineField, FieldT& coarseField,
+                      SAMRAI::hier::Box const& coarseBox) const
+        {
+            using SX = CoarsenRatio2Stencil<cx>;
+            using SY = CoarsenRatio2Stencil<cy>;
+            using SZ = CoarsenRatio2Stencil<cz>;
+
+            auto const fineShape   = fineField.shape();
+            auto const fineStrideY = static_cast<int>(fineShape[dirZ]);
+            auto const fineStrideX = static_cast<int>(fineShape[dirY]) * fineStrideY;
+
+            int const fineShiftX = SX::shift - sourceBox_.lower(dirX);
+            int const fineShiftY = SY::shift - sourceBox_.lower(dirY);
+            int const fineShiftZ = SZ::shift - sourceBox_.lower(dirZ);
+
+            int const coarseLowerZ = coarseBox.lower(dirZ) - destinationBox_.lower(dirZ);
+
+            for (int ix = coarseBox.lower(dirX); ix <= coarseBox.upper(dirX); ++ix)
+            {
+                for (int iy = coarseBox.lower(dirY); iy <= coarseBox.upper(dirY); ++iy)
+                {
+                    double const* fineXY = fineField.data() + (2 * ix + fineShiftX) * fineStrideX
+                                           + (2 * iy + fineShiftY) * fineStrideY;
+                    double* coarse = &coarseField(ix - destinationBox_.lower(dirX),
+                                                  iy - destinationBox_.lower(dirY), coarseLowerZ);
+
+                    for (int iz = coarseBox.lower(dirZ); iz <= coarseBox.upper(dirZ); ++iz)
+                    {
+                        double const* fineXYZ = fineXY + 2 * iz + fineShiftZ;
+                        double value          = 0.;
+
+                        for (std::size_t iShiftX = 0; iShiftX < SX::weights.size(); ++iShiftX)
+                        {
+                            double yValue = 0.;
+                            for (std::size_t iShiftY = 0; iShiftY < SY::weights.size(); ++iShiftY)
+                            {
+                                double const* fineRow
+                                    = fineXYZ + iShiftX * fineStrideX + iShiftY * fineStrideY;
+                                double zValue = 0.;
+                                for (std::size_t iShiftZ = 0; iShiftZ < SZ::weights.size();
+                                     ++iShiftZ)
+                                    zValue += SZ::weights[iShiftZ] * fineRow[iShiftZ];
+
+                                yValue += SY::weights[iShiftY] * zValue;
+                            }
+                            value += SX::weights[iShiftX] * yValue;
+                        }
+
+                        *coarse++ = value;
+                    }
+                }
+            }
+        }
+
+
+
+        std::array<core::QtyCentering, dimension> const centering_;
+        SAMRAI::hier::Box const sourceBox_;
+        SAMRAI::hier::Box const destinationBox_;
+    };
+} // namespace amr
+} // namespace PHARE
+
+
+#endif
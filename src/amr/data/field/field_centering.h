@@ -0,0 +1,48 @@
+#ifndef PHARE_FIELD_CENTERING_H
+#define PHARE_FIELD_CENTERING_H
+
+#include "core/data/grid/gridlayoutdefs.h"
+
+#include <array>
+#include <cstddef>
+
+
+namespace PHARE
+{
+namespace amr
+{
+    //! compile-time list of the centerings of a quantity, one per direction
+    template<core::QtyCentering... centerings>
+    struct CenteringTag
+    {
+    };
+
+
+    /** @brief visitCenterings calls fn with the CenteringTag matching the runtime centerings, so
+     * that kernels can be specialized for each combination of primal/dual directions.
+     */
+    template<std::size_t dimension, core::QtyCentering... centerings, typename Fn>
+    void visitCenterings(std::array<core::QtyCentering, dimension> const& runtimeCenterings,
+                         Fn&& fn)
+    {
+        constexpr auto iDir = sizeof...(centerings);
+
+        if constexpr (iDir == dimension)
+        {
+            fn(CenteringTag<centerings...>{});
+        }
+        else
+        {
+            if (runtimeCenterings[iDir] == core::QtyCentering::primal)
+                visitCenterings<dimension, centerings..., core::QtyCentering::primal>(
+                    runtimeCenterings, fn);
+            else
+                visitCenterings<dimension, centerings..., core::QtyCentering::dual>(
+                    runtimeCenterings, fn);
+        }
+    }
+
+} // namespace amr
+} // namespace PHARE
+
+#endif
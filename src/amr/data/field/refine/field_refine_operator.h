@@ -6,6 +6,7 @@
 #include "core/data/grid/gridlayout.h"
 #include "field_linear_refine.h"
 #include "field_refiner.h"
+#include "field_refiner_ratio2.h"
 
 #include <SAMRAI/hier/RefineOperator.h>
 #include <SAMRAI/tbox/Dimension.h>
@@ -94,6 +95,20 @@ namespace amr
 
 
 
+            // the usual refinement ratio has its own kernel working on whole boxes
+            if (ratio == SAMRAI::hier::IntVector{ratio.getDim(), 2})
+            {
+                FieldRefinerRatio2<dimension> refiner{destinationLayout.centering(qty),
+                                                      destinationFieldBox, sourceFieldBox};
+
+                for (auto const& box : overlapBoxes)
+                {
+                    refiner(sourceField, destinationField, destinationFieldBox * box);
+                }
+                return;
+            }
+
+
             FieldRefiner<dimension> refiner{destinationLayout.centering(qty), destinationFieldBox,
                                             sourceFieldBox, ratio};
 
@@ -0,0 +1,215 @@
+#ifndef PHARE_FIELD_REFINER_RATIO2_H
+#define PHARE_FIELD_REFINER_RATIO2_H
+
+#include "core/data/grid/gridlayoutdefs.h"
+#include "core/utilities/constants.h"
+
+#include "amr/data/field/field_centering.h"
+
+#include <SAMRAI/hier/Box.h>
+
+#include <array>
+#include <cstddef>
+
+
+
+namespace PHARE
+{
+namespace amr
+{
+    using core::dirX;
+    using core::dirY;
+    using core::dirZ;
+
+    /** @brief linear interpolation weights of the two coarse nodes surrounding a fine node for a
+     * refinement ratio of 2, they are the ones the LinearWeighter computes. Weights and the offset
+     * of the left coarse node from fineIndex/2 (floored) depend on the parity of the fine index.
+     */
+    template<core::QtyCentering centering>
+    struct RefineRatio2Stencil;
+
+    template<>
+    struct RefineRatio2Stencil<core::QtyCentering::primal>
+    {
+        // even fine nodes are on top of a coarse node, odd ones are in the middle of two
+        static constexpr std::array<int, 2> shift = {{0, 0}};
+        static constexpr std::array<std::array<double, 2>, 2> weights
+            = {{{{1., 0.}}, {{0.5, 0.5}}}};
+    };
+
+    template<>
+    struct RefineRatio2Stencil<core::QtyCentering::dual>
+    {
+        // even fine nodes are on the left half of a coarse cell, odd ones on the right half
+        static constexpr std::array<int, 2> shift = {{-1, 0}};
+        static constexpr std::array<std::array<double, 2>, 2> weights
+            = {{{{0.25, 0.75}}, {{0.75, 0.25}}}};
+    };
+
+
+
+
+    /** @brief FieldRefinerRatio2 refines a whole box of fine nodes at once when the refinement
+     * ratio is 2 in all directions. It gives the same result as FieldRefiner, but the weights are
+     * known at compile time for each centering, and nodes are traversed with strides on the
+     * underlying arrays, the innermost loop running on contiguous fine nodes.
+     */
+    template<std::size_t dimension>
+    class FieldRefinerRatio2
+    {
+    public:
+        FieldRefinerRatio2(std::array<core::QtyCentering, dimension> const& centering,
+                           SAMRAI::hier::Box const& destinationGhostBox,
+                           SAMRAI::hier::Box const& sourceGhostBox)
+            : centering_{centering}
+            , fineBox_{destinationGhostBox}
+            , coarseBox_{sourceGhostBox}
+        {
+        }
+
+
+        /** @brief refine sourceField onto destinationField on all nodes of fineBox, given in AMR
+         * field indexes.
+         */
+        template<typename FieldT>
+        void operator()(FieldT const& sourceField, FieldT& destinationField,
+                        SAMRAI::hier::Box const& fineBox) const
+        {
+            TBOX_ASSERT(sourceField.physicalQuantity() == destinationField.physicalQuantity());
+
+            if (fineBox.empty())
+                return;
+
+            visitCenterings(centering_, [&](auto centeringTag) {
+                refine_(centeringTag, sourceField, destinationField, fineBox);
+            });
+        }
+
+
+
+    private:
+        //! index of the left coarse node, local to the coarse box, and parity of a fine AMR index
+        static std::array<int, 2> coarseIndexAndParity_(int fineIndex, int coarseLower)
+        {
+            int const parity = fineIndex & 1;
+            return {{(fineIndex - parity) / 2 - coarseLower, parity}};
+        }
+
+
+
+        template<core::QtyCentering cx, typename FieldT>
+        void refine_(CenteringTag<cx>, FieldT const& sourceField, FieldT& destinationField,
+                     SAMRAI::hier::Box const& fineBox) const
+        {
+            using SX = RefineRatio2Stencil<cx>;
+
+            double const* coarse = sourceField.data();
+            double* fine         = &destinationField(fineBox.lower(dirX) - fineBox_.lower(dirX));
+
+            for (int ix = fineBox.lower(dirX); ix <= fineBox.upper(dirX); ++ix)
+            {
+                auto [cx0, px] = coarseIndexAndParity_(ix, coarseBox_.lower(dirX));
+                auto const& wx = SX::weights[px];
+                auto const* cX = coarse + cx0 + SX::shift[px];
+                *fine++        = wx[0] * cX[0] + wx[1] * cX[1];
+            }
+        }
+
+
+
+        template<core::QtyCentering cx, core::QtyCentering cy, typename FieldT>
+        void refine_(CenteringTag<cx, cy>, FieldT const& sourceField, FieldT& destinationField,
+                     SAMRAI::hier::Box const& fineBox) const
+        {
+            using SX = RefineRatio2Stencil<cx>;
+            using SY = RefineRatio2Stencil<cy>;
+
+            auto const coarseStrideX = static_cast<int>(sourceField.shape()[dirY]);
+            int const fineLowerY     = fineBox.lower(dirY) - fineBox_.lower(dirY);
+
+            for (int ix = fineBox.lower(dirX); ix <= fineBox.upper(dirX); ++ix)
+            {
+                auto [cx0, px] = coarseIndexAndParity_(ix, coarseBox_.lower(dirX));
+                auto const& wx = SX::weights[px];
+
+                double const* coarseX = sourceField.data() + (cx0 + SX::shift[px]) * coarseStrideX;
+                double* fine = &destinationField(ix - fineBox_.lower(dirX), fineLowerY);
+
+                for (int iy = fineBox.lower(dirY); iy <= fineBox.upper(dirY); ++iy)
+                {
+                    auto [cy0, py] = coarseIndexAndParity_(iy, coarseBox_.lower(dirY));
+                    auto const& wy = SY::weights[py];
+
+                    double const* c0 = coarseX + cy0 + SY::shift[py];
+                    double const* c1 = c0 + coarseStrideX;
+
+                    *fine++ = wx[0] * (wy[0] * c0[0] + wy[1] * c0[1])
+                              + wx[1] * (wy[0] * c1[0] + wy[1] * c1[1]);
+                }
+            }
+        }
+
+
+
+        template<core::QtyCentering cx, core::QtyCentering cy, core::QtyCentering cz,
+                 typename FieldT>
+        void refine_(CenteringTag<cx, cy, cz>, FieldT const& sourceField, FieldT& destinationField,
+                     SAMRAI::hier::Box const& fineBox) const
+        {
+            using SX = RefineRatio2Stencil<cx>;
+            using SY = RefineRatio2Stencil<cy>;
+            using SZ = RefineRatio2Stencil<cz>;
+
+            auto const coarseShape   = sourceField.shape();
+            auto const coarseStrideY = static_cast<int>(coarseShape[dirZ]);
+            auto const coarseStrideX = static_cast<int>(coarseShape[dirY]) * coarseStrideY;
+            int const fineLowerZ     = fineBox.lower(dirZ) - fineBox_.lower(dirZ);
+
+            for (int ix = fineBox.lower(dirX); ix <= fineBox.upper(dirX); ++ix)
+            {
+                auto [cx0, px] = coarseIndexAndParity_(ix, coarseBox_.lower(dirX));
+                auto const& wx = SX::weights[px];
+
+                for (int iy = fineBox.lower(dirY); iy <= fineBox.upper(dirY); ++iy)
+                {
+                    auto [cy0, py] = coarseIndexAndParity_(iy, coarseBox_.lower(dirY));
+                    auto const& wy = SY::weights[py];
+
+                    double const* coarseXY = sourceField.data()
+                                             + (cx0 + SX::shift[px]) * coarseStrideX
+                                             + (cy0 + SY::shift[py]) * coarseStrideY;
+                    double* fine = &destinationField(ix - fineBox_.lower(dirX),
+                                                     iy - fineBox_.lower(dirY), fineLowerZ);
+
+                    for (int iz = fineBox.lower(dirZ); iz <= fineBox.upper(dirZ); ++iz)
+                    {
+                        auto [cz0, pz] = coarseIndexAndParity_(iz, coarseBox_.lower(dirZ));
+                        auto const& wz = SZ::weights[pz];
+
+                        double const* c00 = coarseXY + cz0 + SZ::shift[pz];
+                        double const* c01 = c00 + coarseStrideY;
+                        double const* c10 = c00 + coarseStrideX;
+                        double const* c11 = c10 + coarseStrideY;
+
+                        *fine++ = wx[0]
+                                      * (wy[0] * (wz[0] * c00[0] + wz[1] * c00[1])
+                                         + wy[1] * (wz[0] * c01[0] + wz[1] * c01[1]))
+                                  + wx[1]
+                                        * (wy[0] * (wz[0] * c10[0] + wz[1] * c10[1])
+                                           + wy[1] * (wz[0] * c11[0] + wz[1] * c11[1]));
+                    }
+                }
+            }
+        }
+
+
+
+        std::array<core::QtyCentering, dimension> const centering_;
+        SAMRAI::hier::Box const fineBox_;
+        SAMRAI::hier::Box const coarseBox_;
+    };
+} // namespace amr
+} // namespace PHARE
+
+
+#endif
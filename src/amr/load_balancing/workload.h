@@ -0,0 +1,107 @@
+#ifndef PHARE_AMR_LOAD_BALANCING_WORKLOAD_H
+#define PHARE_AMR_LOAD_BALANCING_WORKLOAD_H
+
+#include <SAMRAI/hier/Index.h>
+#include <SAMRAI/hier/IntVector.h>
+#include <SAMRAI/hier/Patch.h>
+#include <SAMRAI/hier/PatchLevel.h>
+#include <SAMRAI/hier/VariableDatabase.h>
+#include <SAMRAI/pdat/CellData.h>
+#include <SAMRAI/pdat/CellIndex.h>
+#include <SAMRAI/pdat/CellVariable.h>
+#include <SAMRAI/tbox/Dimension.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+
+namespace PHARE::amr
+{
+/**
+ * @brief Workload owns the cell-centered patch data giving the computational cost of each cell.
+ * Its index is given to the SAMRAI load balancer so that patches are distributed according to
+ * their cost rather than to their number of cells.
+ *
+ * The cost of a cell is 1 (field solver) plus the number of particles it holds, since pushing
+ * and depositing particles dominates the cost of a hybrid PIC step.
+ */
+class Workload
+{
+public:
+    explicit Workload(SAMRAI::tbox::Dimension const& dim)
+        : variableDatabase_{SAMRAI::hier::VariableDatabase::getDatabase()}
+        , variable_{std::make_shared<SAMRAI::pdat::CellVariable<double>>(dim, name_, 1)}
+        , index_{variableDatabase_->registerVariableAndContext(
+              variable_, variableDatabase_->getContext("default"),
+              SAMRAI::hier::IntVector::getZero(dim))}
+    {
+    }
+
+    Workload(Workload const&) = delete;
+    Workload(Workload&&)      = delete;
+    Workload& operator=(Workload const&) = delete;
+    Workload& operator=(Workload&&) = delete;
+
+    ~Workload() { variableDatabase_->removeVariable(name_); }
+
+
+    int index() const { return index_; }
+
+
+    void allocate(SAMRAI::hier::PatchLevel& level, double const time) const
+    {
+        if (!level.checkAllocated(index_))
+            level.allocatePatchData(index_, time);
+    }
+
+
+    /**
+     * @brief reset sets the cost of each cell of the patch to 1, the cost of the field solver
+     */
+    void reset(SAMRAI::hier::Patch& patch) const { data_(patch).fill(1.); }
+
+
+    /**
+     * @brief addParticles adds to the cost of each cell of the patch the number of particles of
+     * the given array it contains. Particle cell indexes are AMR indexes, so that particles
+     * outside the patch box (e.g. ghosts) are not counted.
+     */
+    template<typename ParticleArray>
+    void addParticles(SAMRAI::hier::Patch& patch, ParticleArray const& particles) const
+    {
+        auto& workload  = data_(patch);
+        auto const& box = patch.getBox();
+        SAMRAI::hier::Index amrIndex{box.lower()};
+
+        for (auto const& particle : particles)
+        {
+            for (std::size_t iDim = 0; iDim < ParticleArray::dimension; ++iDim)
+                amrIndex(iDim) = particle.iCell[iDim];
+
+            if (box.contains(amrIndex))
+                workload(SAMRAI::pdat::CellIndex{amrIndex}) += 1.;
+        }
+    }
+
+
+private:
+    SAMRAI::pdat::CellData<double>& data_(SAMRAI::hier::Patch& patch) const
+    {
+        auto workload = std::dynamic_pointer_cast<SAMRAI::pdat::CellData<double>>(
+            patch.getPatchData(index_));
+        if (!workload)
+            throw std::runtime_error("Error - Workload not allocated on patch");
+        return *workload;
+    }
+
+    static inline std::string const name_{"PHARE_workload"};
+
+    SAMRAI::hier::VariableDatabase* variableDatabase_;
+    std::shared_ptr<SAMRAI::pdat::CellVariable<double>> variable_;
+    int index_;
+};
+
+} // namespace PHARE::amr
+
+#endif
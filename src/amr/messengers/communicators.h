@@ -2,6 +2,7 @@
 #define PHARE_COMMUNICATORS_H
 
 #include "quantity_communicator.h"
+#include "core/logger.h"
 
 #include <SAMRAI/hier/RefineOperator.h>
 
@@ -224,8 +225,8 @@ namespace amr
 
                 if constexpr (Type == RefinerType::LevelBorderParticles)
                 {
-                    std::cout << "regriding adding levelghostparticles on level " << levelNumber
-                              << " " << key << "\n";
+                    PHARE_LOG(PHARE_LOG_DEBUG, core::LogEntry{"regridLevelGhostParticles"}(
+                                                   "level", levelNumber)("quantity", key));
                     auto schedule = algo->createSchedule(
                         std::make_shared<SAMRAI::xfer::PatchLevelBorderFillPattern>(), level,
                         oldLevel, level->getNextCoarserHierarchyLevelNumber(), hierarchy);
@@ -233,7 +234,8 @@ namespace amr
                 }
                 else
                 {
-                    std::cout << "regriding adding " << key << " on level " << levelNumber << " \n";
+                    PHARE_LOG(PHARE_LOG_DEBUG,
+                              core::LogEntry{"regrid"}("level", levelNumber)("quantity", key));
                     auto schedule = algo->createSchedule(
                         level, oldLevel, level->getNextCoarserHierarchyLevelNumber(), hierarchy);
                     schedule->fillData(initDataTime);
@@ -16,6 +16,8 @@
 #include "core/numerics/interpolator/interpolator.h"
 #include "core/numerics/moments/moments.h"
 #include "core/hybrid/hybrid_quantities.h"
+#include "core/logger.h"
+#include "core/timers.h"
 
 
 
@@ -24,8 +26,11 @@
 
 
 #include <iterator>
+#include <map>
 #include <optional>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 
 namespace PHARE
@@ -170,19 +175,26 @@ namespace amr
         /**
          * @brief regrid performs the regriding communications for Hybrid to Hybrid messengers
          *
-         * basically, all quantities that are in initialization refiners need to be regridded
+         * basically, all quantities that are in initialization refiners need to be regridded.
+         * The root level, regridded when the hierarchy is rebalanced, is entirely copied from the
+         * old root level and has no level ghost particles.
          */
         void regrid(std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy,
                     const int levelNumber,
                     std::shared_ptr<SAMRAI::hier::PatchLevel> const& oldLevel,
                     IPhysicalModel& model, double const initDataTime) override
         {
+            PHARE_TIMER_SCOPE("regrid");
             auto level = hierarchy->getPatchLevel(levelNumber);
             magneticInit_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
             electricInit_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
             interiorParticles_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
-            levelGhostParticlesOld_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
-            copyLevelGhostOldToPushable_(*level, model);
+            if (levelNumber > 0)
+            {
+                levelGhostParticlesOld_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
+                copyLevelGhostOldToPushable_(*level, model);
+                clearLevelGhostMoments_(levelNumber);
+            }
             // computeIonMoments_(*level, model);
             // levelGhostNew will be refined in next firstStep
         }
@@ -221,6 +233,7 @@ namespace amr
         void initLevel(IPhysicalModel& model, SAMRAI::hier::PatchLevel& level,
                        double const initDataTime) override
         {
+            PHARE_TIMER_SCOPE("initLevel");
             auto levelNumber = level.getLevelNumber();
 
             magneticInit_.fill(levelNumber, initDataTime);
@@ -245,6 +258,7 @@ namespace amr
             // levelGhostParticles will be pushed during the advance phase
             // they need to be identical to levelGhostParticlesOld before advance
             copyLevelGhostOldToPushable_(level, model);
+            clearLevelGhostMoments_(levelNumber);
 
             // computeIonMoments_(level, model);
         }
@@ -268,6 +282,7 @@ namespace amr
          */
         void fillMagneticGhosts(VecFieldT& B, int const levelNumber, double const fillTime) override
         {
+            PHARE_TIMER_SCOPE("fillMagneticGhosts");
             magneticGhosts_.fill(B, levelNumber, fillTime);
         }
 
@@ -276,6 +291,7 @@ namespace amr
 
         void fillElectricGhosts(VecFieldT& E, int const levelNumber, double const fillTime) override
         {
+            PHARE_TIMER_SCOPE("fillElectricGhosts");
             electricGhosts_.fill(E, levelNumber, fillTime);
         }
 
@@ -284,6 +300,7 @@ namespace amr
 
         void fillCurrentGhosts(VecFieldT& J, int const levelNumber, double const fillTime) override
         {
+            PHARE_TIMER_SCOPE("fillCurrentGhosts");
             currentGhosts_.fill(J, levelNumber, fillTime);
         }
 
@@ -297,6 +314,7 @@ namespace amr
         void fillIonGhostParticles(IonsT& ions, SAMRAI::hier::PatchLevel& level,
                                    double const fillTime) override
         {
+            PHARE_TIMER_SCOPE("fillIonGhostParticles");
             for (auto patch : level)
             {
                 auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
@@ -316,20 +334,33 @@ namespace amr
          * @brief fillIonMomentGhosts will compute the ion moments for all species on ghost nodes.
          *
          * For patch ghost nodes, patch ghost particles are used.
-         * For level ghost nodes, levelGhostParticlesOld and new are both projected with a time
-         * interpolation coef.
+         * For level ghost nodes, the moments of levelGhostParticlesOld and new, cached at
+         * firstStep, are blended with a time interpolation coef. If no cached moments exist for
+         * a patch, levelGhostParticlesOld and new are projected directly.
          */
         void fillIonMomentGhosts(IonsT& ions, SAMRAI::hier::PatchLevel& level,
                                  double const beforePushTime, double const afterPushTime) override
         {
-            auto alpha = timeInterpCoef_(beforePushTime, afterPushTime);
+            PHARE_TIMER_SCOPE("fillIonMomentGhosts");
+            auto alpha       = timeInterpCoef_(beforePushTime, afterPushTime);
+            auto levelNumber = level.getLevelNumber();
 
+            auto& momentsOld = levelGhostMomentsOld_[levelNumber];
+            auto& momentsNew = levelGhostMomentsNew_[levelNumber];
 
             for (auto patch : level)
             {
                 auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
                 auto layout      = layoutFromPatch<GridLayoutT>(*patch);
 
+                auto cachedOld = momentsOld.find(patch->getGlobalId());
+                auto cachedNew = momentsNew.find(patch->getGlobalId());
+                bool isCached  = cachedOld != std::end(momentsOld)
+                                && cachedNew != std::end(momentsNew)
+                                && cachedOld->second.size() == ions.nbrPopulations()
+                                && cachedNew->second.size() == ions.nbrPopulations();
+
+                std::size_t popIndex = 0;
                 for (auto& pop : ions)
                 {
                     // first thing to do is to project patchGhostParitcles moments
@@ -340,16 +371,25 @@ namespace amr
                     interpolate_(std::begin(patchGhosts), std::end(patchGhosts), density, flux,
                                  layout);
 
-
-                    // then grab levelGhostParticlesOld and levelGhostParticlesNew
-                    // and project them with alpha and (1-alpha) coefs, respectively
-                    auto& levelGhostOld = pop.levelGhostParticlesOld();
-                    interpolate_(std::begin(levelGhostOld), std::end(levelGhostOld), density, flux,
-                                 layout, 1. - alpha);
-
-                    auto& levelGhostNew = pop.levelGhostParticlesNew();
-                    interpolate_(std::begin(levelGhostNew), std::end(levelGhostNew), density, flux,
-                                 layout, alpha);
+                    if (isCached)
+                    {
+                        // levelGhostParticlesOld and levelGhostParticlesNew moments
+                        // are added with (1-alpha) and alpha coefs, respectively
+                        addLevelGhostMoments_(cachedOld->second[popIndex], density, flux,
+                                              1. - alpha);
+                        addLevelGhostMoments_(cachedNew->second[popIndex], density, flux, alpha);
+                    }
+                    else
+                    {
+                        auto& levelGhostOld = pop.levelGhostParticlesOld();
+                        interpolate_(std::begin(levelGhostOld), std::end(levelGhostOld), density,
+                                     flux, layout, 1. - alpha);
+
+                        auto& levelGhostNew = pop.levelGhostParticlesNew();
+                        interpolate_(std::begin(levelGhostNew), std::end(levelGhostNew), density,
+                                     flux, layout, alpha);
+                    }
+                    ++popIndex;
                 }
             }
         }
@@ -362,27 +402,30 @@ namespace amr
          * in the future at the time the method is called because the coarser level is ahead in
          * time. These particles are communicated only at first step of a substepping cycle. They
          * will be used with the levelGhostParticlesOld particles to get the moments on level border
-         * nodes.
+         * nodes. The moments of levelGhostParticlesOld and levelGhostParticlesNew are computed
+         * here once per substepping cycle, since these particles do not change until lastStep.
          * The method is does nothing if the level is the root level because the root level
          * cannot get levelGhost from next coarser (it has none).
          */
-        void firstStep(IPhysicalModel& /*model*/, SAMRAI::hier::PatchLevel& level,
+        void firstStep(IPhysicalModel& model, SAMRAI::hier::PatchLevel& level,
                        std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& /*hierarchy*/,
                        double time, double newCoarserTime) override
         {
+            PHARE_TIMER_SCOPE("firstStep");
             auto levelNumber = level.getLevelNumber();
 
             // root level has no levelghost particles
             if (levelNumber != 0)
             {
-                std::cout << "level " << level.getLevelNumber()
-                          << " FIRST STEP : filling levelghostNew from next coarser\n";
+                PHARE_LOG(PHARE_LOG_DEBUG, core::LogEntry{"firstStep"}("level", levelNumber));
                 levelGhostParticlesNew_.fill(levelNumber, time);
 
                 // during firstStep() coarser level and current level are at the same time
                 // so 'time' is also the beforePushCoarseTime_
                 beforePushCoarseTime_ = time;
                 afterPushCoarseTime_  = newCoarserTime;
+
+                cacheLevelGhostMoments_(level, model);
             }
         }
 
@@ -393,10 +436,13 @@ namespace amr
          * moves levelGhostParticlesNew particles into levelGhostParticlesOld ones. Then
          * levelGhostParticlesNew are emptied since it will be filled again at firstStep of the next
          * substepping cycle. the new CoarseToFineOld content is then copied to levelGhostParticles
-         * so that they can be pushed during the next subcycle
+         * so that they can be pushed during the next subcycle. No array is reallocated unless the
+         * number of level ghost particles grows. The cached levelGhostParticlesNew moments become
+         * the levelGhostParticlesOld ones as well.
          */
         void lastStep(IPhysicalModel& model, SAMRAI::hier::PatchLevel& level) override
         {
+            PHARE_TIMER_SCOPE("lastStep");
             auto& hybridModel = static_cast<HybridModel&>(model);
             for (auto& patch : level)
             {
@@ -408,22 +454,25 @@ namespace amr
                     auto& levelGhostParticlesNew = pop.levelGhostParticlesNew();
                     auto& levelGhostParticles    = pop.levelGhostParticles();
 
-                    std::cout
-                        << "level " << level.getLevelNumber()
-                        << " : LAST STEP : copying new into old levelghost, emptying new, empty "
-                           "pushable, "
-                           "copying old into "
-                           "pushable\n";
+                    // old, new and pushable arrays keep their capacity across cycles :
+                    // swapping gives new the buffer of the previous old, and the pushable
+                    // array is overwritten in place.
                     core::swap(levelGhostParticlesNew, levelGhostParticlesOld);
                     core::empty(levelGhostParticlesNew);
-                    core::empty(levelGhostParticles);
-                    std::copy(std::begin(levelGhostParticlesOld), std::end(levelGhostParticlesOld),
-                              std::back_inserter(levelGhostParticles));
-                    std::cout << "new : " << levelGhostParticlesNew.size() << " "
-                              << " old : " << levelGhostParticlesOld.size() << " "
-                              << "pushable : " << levelGhostParticles.size() << "\n";
+                    levelGhostParticlesNew.reserve(levelGhostParticlesOld.size());
+                    levelGhostParticles.copyData(levelGhostParticlesOld);
+
+                    PHARE_LOG(PHARE_LOG_DEBUG,
+                              core::LogEntry{"lastStep"}("level", level.getLevelNumber())(
+                                  "population", pop.name())(
+                                  "levelGhostOld", levelGhostParticlesOld.size())(
+                                  "levelGhost", levelGhostParticles.size()));
                 }
             }
+
+            auto levelNumber                   = level.getLevelNumber();
+            levelGhostMomentsOld_[levelNumber] = std::move(levelGhostMomentsNew_[levelNumber]);
+            levelGhostMomentsNew_[levelNumber].clear();
         }
 
 
@@ -477,6 +526,7 @@ namespace amr
 
         void synchronize(SAMRAI::hier::PatchLevel& level) override
         {
+            PHARE_TIMER_SCOPE("synchronize");
             auto levelNumber = level.getLevelNumber();
 
             // call coarsning schedules...
@@ -489,6 +539,24 @@ namespace amr
 
 
     private:
+        //! non-zero node contributions of a particle array to one moment component
+        struct SparseMoment
+        {
+            std::vector<std::size_t> index;
+            std::vector<double> value;
+        };
+
+        //! moments of a level ghost particle array of one population on one patch
+        struct LevelGhostMoments
+        {
+            SparseMoment density, xFlux, yFlux, zFlux;
+        };
+
+        using PatchLevelGhostMoments
+            = std::map<SAMRAI::hier::GlobalId, std::vector<LevelGhostMoments>>;
+
+
+
         void registerGhostComms_(std::unique_ptr<HybridMessengerInfo> const& info)
         {
             auto const& Eold = EM_old_.E;
@@ -616,9 +684,48 @@ namespace amr
                     auto& levelGhostParticlesOld = pop.levelGhostParticlesOld();
                     auto& levelGhostParticles    = pop.levelGhostParticles();
 
-                    core::empty(levelGhostParticles);
-                    std::copy(std::begin(levelGhostParticlesOld), std::end(levelGhostParticlesOld),
-                              std::back_inserter(levelGhostParticles));
+                    levelGhostParticles.copyData(levelGhostParticlesOld);
+                }
+            }
+        }
+
+
+
+
+        /**
+         * @brief cacheLevelGhostMoments_ computes, for all patches and populations of the level,
+         * the moments of levelGhostParticlesNew, and those of levelGhostParticlesOld if they were
+         * not already obtained from the previous substepping cycle.
+         */
+        void cacheLevelGhostMoments_(SAMRAI::hier::PatchLevel& level, IPhysicalModel& model)
+        {
+            auto& hybridModel = static_cast<HybridModel&>(model);
+            auto& ions        = hybridModel.state.ions;
+            auto levelNumber  = level.getLevelNumber();
+
+            auto& momentsOld = levelGhostMomentsOld_[levelNumber];
+            auto& momentsNew = levelGhostMomentsNew_[levelNumber];
+            momentsNew.clear();
+
+            for (auto& patch : level)
+            {
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+                auto layout      = layoutFromPatch<GridLayoutT>(*patch);
+                auto patchID     = patch->getGlobalId();
+
+                bool const hasOld = momentsOld.count(patchID) > 0
+                                    and momentsOld[patchID].size() == ions.nbrPopulations();
+                if (!hasOld)
+                    momentsOld[patchID].clear();
+
+                for (auto& pop : ions)
+                {
+                    if (!hasOld)
+                        momentsOld[patchID].push_back(
+                            levelGhostMoments_(pop.levelGhostParticlesOld(), pop, layout));
+
+                    momentsNew[patchID].push_back(
+                        levelGhostMoments_(pop.levelGhostParticlesNew(), pop, layout));
                 }
             }
         }
@@ -626,6 +733,90 @@ namespace amr
 
 
 
+        /**
+         * @brief levelGhostMoments_ projects the given particles onto temporary fields shaped
+         * like the population moments and only keeps the nodes they contribute to.
+         */
+        template<typename ParticleArray, typename Population>
+        LevelGhostMoments levelGhostMoments_(ParticleArray& particles, Population& pop,
+                                             GridLayoutT const& layout)
+        {
+            LevelGhostMoments moments;
+            if (particles.size() == 0)
+                return moments;
+
+            auto& popFlux = pop.flux();
+
+            FieldT density{"levelGhostDensity", pop.density().physicalQuantity(),
+                           pop.density().shape()};
+            VecFieldT flux{"levelGhostFlux", core::HybridQuantity::Vector::V};
+
+            std::vector<FieldT> fluxComponents;
+            fluxComponents.reserve(3);
+            for (auto type : {core::Component::X, core::Component::Y, core::Component::Z})
+            {
+                auto& component = popFlux.getComponent(type);
+                fluxComponents.emplace_back(flux.getComponentName(type),
+                                            component.physicalQuantity(), component.shape());
+            }
+
+            auto fluxProperties = flux.getFieldNamesAndQuantities();
+            for (std::size_t i = 0; i < fluxComponents.size(); ++i)
+                flux.setBuffer(fluxProperties[i].name, &fluxComponents[i]);
+
+            interpolate_(std::begin(particles), std::end(particles), density, flux, layout);
+
+            auto keepNonZero = [](FieldT const& field, SparseMoment& sparse) {
+                std::size_t index = 0;
+                for (auto const& value : field)
+                {
+                    if (value != 0.)
+                    {
+                        sparse.index.push_back(index);
+                        sparse.value.push_back(value);
+                    }
+                    ++index;
+                }
+            };
+
+            keepNonZero(density, moments.density);
+            keepNonZero(fluxComponents[0], moments.xFlux);
+            keepNonZero(fluxComponents[1], moments.yFlux);
+            keepNonZero(fluxComponents[2], moments.zFlux);
+
+            return moments;
+        }
+
+
+
+
+        void addLevelGhostMoments_(LevelGhostMoments const& moments, FieldT& density,
+                                   VecFieldT& flux, double const coef)
+        {
+            auto add = [coef](SparseMoment const& sparse, FieldT& field) {
+                auto data = std::begin(field);
+                for (std::size_t i = 0; i < sparse.index.size(); ++i)
+                    data[sparse.index[i]] += coef * sparse.value[i];
+            };
+
+            add(moments.density, density);
+            add(moments.xFlux, flux.getComponent(core::Component::X));
+            add(moments.yFlux, flux.getComponent(core::Component::Y));
+            add(moments.zFlux, flux.getComponent(core::Component::Z));
+        }
+
+
+
+
+        void clearLevelGhostMoments_(int const levelNumber)
+        {
+            levelGhostMomentsOld_.erase(levelNumber);
+            levelGhostMomentsNew_.erase(levelNumber);
+        }
+
+
+
+
         double timeInterpCoef_(double const beforePushTime, double const afterPushTime)
         {
             return (afterPushTime - beforePushTime)
@@ -653,6 +844,13 @@ namespace amr
         core::Interpolator<dimension, interpOrder> interpolate_;
 
 
+        //! per level and patch, levelGhostParticlesOld moments for each population
+        std::unordered_map<int, PatchLevelGhostMoments> levelGhostMomentsOld_;
+
+        //! per level and patch, levelGhostParticlesNew moments for each population
+        std::unordered_map<int, PatchLevelGhostMoments> levelGhostMomentsNew_;
+
+
         //! store communicators for magnetic fields that need ghosts to be filled
         RefinerPool<RefinerType::GhostField> magneticGhosts_;
 
@@ -16,6 +16,9 @@
 #include <SAMRAI/tbox/InputManager.h>
 #include <SAMRAI/tbox/MemoryDatabase.h>
 
+#include <memory>
+#include <vector>
+#include <functional>
 
 
 #include "initializer/data_provider.h"
@@ -29,7 +32,16 @@ class Integrator
 public:
     static constexpr std::size_t dimension = _dimension;
 
-    double advance(double dt) { return timeRefIntegrator_->advanceHierarchy(dt); }
+    double advance(double dt)
+    {
+        auto const newDt = timeRefIntegrator_->advanceHierarchy(dt);
+
+        if (rebalanceInterval_ > 0
+            && timeRefIntegrator_->getIntegratorStep() % rebalanceInterval_ == 0)
+            rebalance_();
+
+        return newDt;
+    }
 
     void initialize() { timeRefIntegrator_->initializeHierarchy(); }
 
@@ -38,10 +50,19 @@ public:
                std::shared_ptr<SAMRAI::hier::PatchHierarchy> hierarchy,
                std::shared_ptr<SAMRAI::algs::TimeRefinementLevelStrategy> timeRefLevelStrategy,
                std::shared_ptr<SAMRAI::mesh::StandardTagAndInitStrategy> tagAndInitStrategy,
-               double startTime, double endTime);
+               double startTime, double endTime, int workloadIndex,
+               std::function<void()> computeWorkload);
 
 private:
+    void rebalance_();
+
+    std::function<void()> computeWorkload_; // fills the workload of all levels
+
+    std::shared_ptr<SAMRAI::hier::PatchHierarchy> hierarchy_;
+    std::shared_ptr<SAMRAI::mesh::GriddingAlgorithm> gridding_;
     std::shared_ptr<SAMRAI::algs::TimeRefinementIntegrator> timeRefIntegrator_;
+    std::vector<int> tagBuffer_;
+    int rebalanceInterval_ = 0;
 };
 
 
@@ -64,11 +85,22 @@ Integrator<_dimension>::Integrator(
     PHARE::initializer::PHAREDict dict, std::shared_ptr<SAMRAI::hier::PatchHierarchy> hierarchy,
     std::shared_ptr<SAMRAI::algs::TimeRefinementLevelStrategy> timeRefLevelStrategy,
     std::shared_ptr<SAMRAI::mesh::StandardTagAndInitStrategy> tagAndInitStrategy, double startTime,
-    double endTime)
+    double endTime, int workloadIndex, std::function<void()> computeWorkload)
+    : computeWorkload_{std::move(computeWorkload)}
+    , hierarchy_{hierarchy}
+    , tagBuffer_(hierarchy->getMaxNumberOfLevels(), 10)
 {
     auto loadBalancer = std::make_shared<SAMRAI::mesh::TreeLoadBalancer>(
         SAMRAI::tbox::Dimension{dimension}, "LoadBalancer");
 
+    // patches are balanced according to their workload (e.g. number of particles) rather than
+    // to their number of cells, on all levels
+    loadBalancer->setWorkloadPatchDataIndex(workloadIndex);
+
+    auto& amr = dict["simulation"]["AMR"];
+    if (amr.contains("load_balancing") && amr["load_balancing"].contains("rebalance_interval"))
+        rebalanceInterval_ = amr["load_balancing"]["rebalance_interval"].template to<int>();
+
     auto refineDB    = getUserRefinementBoxesDatabase<dimension>(dict["simulation"]["AMR"]);
     auto standardTag = std::make_shared<SAMRAI::mesh::StandardTagAndInitialize>(
         "StandardTagAndInitialize", tagAndInitStrategy.get(), refineDB);
@@ -77,7 +109,7 @@ Integrator<_dimension>::Integrator(
     auto clustering
         = std::make_shared<SAMRAI::mesh::BergerRigoutsos>(SAMRAI::tbox::Dimension{dimension});
 
-    auto gridding = std::make_shared<SAMRAI::mesh::GriddingAlgorithm>(
+    gridding_ = std::make_shared<SAMRAI::mesh::GriddingAlgorithm>(
         hierarchy, "GriddingAlgorithm", std::shared_ptr<SAMRAI::tbox::Database>{}, standardTag,
         clustering, loadBalancer);
 
@@ -88,11 +120,89 @@ Integrator<_dimension>::Integrator(
     db->putDouble("start_time", startTime);
     db->putDouble("end_time", endTime);
     db->putInteger("max_integrator_steps", 1000000);
-    db->putIntegerVector("tag_buffer", std::vector<int>(hierarchy->getMaxNumberOfLevels(), 10));
+    db->putIntegerVector("tag_buffer", tagBuffer_);
+
+    // number of coarsest level steps between two regrids when tagging is used
+    if (amr.contains("refinement") && amr["refinement"].contains("tagging")
+        && amr["refinement"]["tagging"].contains("regrid_interval"))
+    {
+        db->putInteger("regrid_interval",
+                       amr["refinement"]["tagging"]["regrid_interval"].template to<int>());
+    }
 
 
     timeRefIntegrator_ = std::make_shared<SAMRAI::algs::TimeRefinementIntegrator>(
-        "TimeRefinementIntegrator", db, hierarchy, timeRefLevelStrategy, gridding);
+        "TimeRefinementIntegrator", db, hierarchy, timeRefLevelStrategy, gridding_);
+}
+
+
+
+
+/**
+ * @brief rebalance_ redistributes the hierarchy among MPI ranks according to the current
+ * workload, independently of the regrid frequency. The coarsest level is rebuilt from its own
+ * boxes, SAMRAI giving the old level to the level initializer which copies its data from it, and
+ * finer levels are regridded so that they remain properly nested.
+ */
+template<std::size_t _dimension>
+void Integrator<_dimension>::rebalance_()
+{
+    auto const time = timeRefIntegrator_->getIntegratorTime();
+    auto const step = timeRefIntegrator_->getIntegratorStep();
+
+    computeWorkload_();
+    gridding_->makeCoarsestLevel(time);
+
+    if (hierarchy_->getNumberOfLevels() > 1)
+        gridding_->regridAllFinerLevels(0, tagBuffer_, step, time);
+}
+
+
+
+
+template<std::size_t dimension>
+void putRefinementBoxes(PHARE::initializer::PHAREDict& refDict, int maxLevelNumber,
+                        SAMRAI::tbox::Database& database)
+{
+    for (int levelNumber = 0; levelNumber < maxLevelNumber; ++levelNumber)
+    {
+        // not all levels are necessarily specified for refinement
+        // cppdict will throw when trying to access key L{i} with i = levelNumber
+        std::string levelString{"L" + std::to_string(levelNumber)};
+        if (refDict.contains(levelString))
+        {
+            auto& levelDict = refDict[levelString];
+            auto samraiDim  = SAMRAI::tbox::Dimension{dimension};
+            auto nbrBoxes   = levelDict["nbr_boxes"].template to<int>();
+            auto levelDB    = database.putDatabase("level_" + std::to_string(levelNumber));
+
+            std::vector<SAMRAI::tbox::DatabaseBox> dbBoxes;
+            for (int iBox = 0; iBox < nbrBoxes; ++iBox)
+            {
+                int lower[dimension];
+                int upper[dimension];
+                auto& boxDict = levelDict["B" + std::to_string(iBox)];
+
+                lower[0] = boxDict["lower"]["x"].template to<int>();
+                upper[0] = boxDict["upper"]["x"].template to<int>();
+
+                if constexpr (dimension >= 2)
+                {
+                    lower[1] = boxDict["lower"]["y"].template to<int>();
+                    upper[1] = boxDict["upper"]["y"].template to<int>();
+                }
+
+                if constexpr (dimension == 3)
+                {
+                    lower[2] = boxDict["lower"]["z"].template to<int>();
+                    upper[2] = boxDict["upper"]["z"].template to<int>();
+                }
+
+                dbBoxes.push_back(SAMRAI::tbox::DatabaseBox(samraiDim, lower, upper));
+            }
+            levelDB->putDatabaseBoxVector("boxes", dbBoxes);
+        }
+    } // end loop on levels
 }
 
 
@@ -104,10 +214,27 @@ getUserRefinementBoxesDatabase(PHARE::initializer::PHAREDict& amr)
 {
     auto& refinement    = amr[std::string{"refinement"}];
     auto maxLevelNumber = amr["max_nbr_levels"].template to<int>();
-    if (refinement.contains("boxes"))
+
+    // a tagging simulation restarting from a checkpoint first rebuilds the levels of the
+    // checkpoint, given as boxes, then tags as usual
+    if (refinement.contains("boxes") and refinement.contains("tagging"))
     {
-        auto& refDict = refinement["boxes"];
+        std::shared_ptr<SAMRAI::tbox::MemoryDatabase> tagDB
+            = std::make_shared<SAMRAI::tbox::MemoryDatabase>("StandardTagAndInitialize");
+
+        auto at0db = tagDB->putDatabase("at_0");
+        at0db->putInteger("cycle", 0);
+        auto tag0db = at0db->putDatabase("tag_0");
+        tag0db->putString("tagging_method", "REFINE_BOXES");
+        putRefinementBoxes<dimension>(refinement["boxes"], maxLevelNumber, *tag0db);
 
+        auto at1db = tagDB->putDatabase("at_1");
+        at1db->putInteger("cycle", 1);
+        at1db->putDatabase("tag_0")->putString("tagging_method", "GRADIENT_DETECTOR");
+        return tagDB;
+    }
+    else if (refinement.contains("boxes"))
+    {
         std::shared_ptr<SAMRAI::tbox::MemoryDatabase> refinementBoxesDatabase
             = std::make_shared<SAMRAI::tbox::MemoryDatabase>("StandardTagAndInitialize");
 
@@ -118,47 +245,8 @@ getUserRefinementBoxesDatabase(PHARE::initializer::PHAREDict& amr)
         std::cout << "tagging method is set to REFINE_BOXES\n";
         refinementBoxesDatabase->putString("tagging_method", "REFINE_BOXES");
 
-
-        for (int levelNumber = 0; levelNumber < maxLevelNumber; ++levelNumber)
-        {
-            // not all levels are necessarily specified for refinement
-            // cppdict will throw when trying to access key L{i} with i = levelNumber
-            std::string levelString{"L" + std::to_string(levelNumber)};
-            if (refDict.contains(levelString))
-            {
-                auto& levelDict = refDict[levelString];
-                auto samraiDim  = SAMRAI::tbox::Dimension{dimension};
-                auto nbrBoxes   = levelDict["nbr_boxes"].template to<int>();
-                auto levelDB
-                    = refinementBoxesDatabase->putDatabase("level_" + std::to_string(levelNumber));
-
-                std::vector<SAMRAI::tbox::DatabaseBox> dbBoxes;
-                for (int iBox = 0; iBox < nbrBoxes; ++iBox)
-                {
-                    int lower[dimension];
-                    int upper[dimension];
-                    auto& boxDict = levelDict["B" + std::to_string(iBox)];
-
-                    lower[0] = boxDict["lower"]["x"].template to<int>();
-                    upper[0] = boxDict["upper"]["x"].template to<int>();
-
-                    if constexpr (dimension >= 2)
-                    {
-                        lower[1] = boxDict["lower"]["y"].template to<int>();
-                        upper[1] = boxDict["upper"]["y"].template to<int>();
-                    }
-
-                    if constexpr (dimension == 3)
-                    {
-                        lower[2] = boxDict["lower"]["z"].template to<int>();
-                        upper[2] = boxDict["upper"]["z"].template to<int>();
-                    }
-
-                    dbBoxes.push_back(SAMRAI::tbox::DatabaseBox(samraiDim, lower, upper));
-                }
-                levelDB->putDatabaseBoxVector("boxes", dbBoxes);
-            }
-        } // end loop on levels
+        putRefinementBoxes<dimension>(refinement["boxes"], maxLevelNumber,
+                                      *refinementBoxesDatabase);
         return refinementBoxesDatabase;
     }
     else if (refinement.contains("tagging"))
@@ -3,12 +3,17 @@
 
 #include <memory>
 #include <random>
+#include <tuple>
+#include <thread>
+#include <vector>
 #include <cassert>
+#include <algorithm>
 #include <functional>
 
 #include "core/data/grid/gridlayoutdefs.h"
 #include "core/hybrid/hybrid_quantities.h"
 #include "core/utilities/types.h"
+#include "core/utilities/counter_rng.h"
 #include "core/data/ions/particle_initializers/particle_initializer.h"
 #include "core/data/particles/particle.h"
 #include "initializer/data_provider.h"
@@ -29,6 +34,14 @@ void localMagneticBasis(std::array<double, 3> B, std::array<std::array<double, 3
 
 /** @brief a MaxwellianParticleInitializer is a ParticleInitializer that loads particles from a
  * local Maxwellian distribution given density, bulk velocity and thermal velocity profiles.
+ *
+ * The random draws of a particle are those of a CounterRNG keyed by the seed, the mesh size and
+ * AMR index of its cell and its index in the cell, so that cells can be loaded in any order, by
+ * nbrThreads threads, and give the same particles whatever the number of threads.
+ *
+ * Given the origin of the physical domain, the profiles are evaluated at cell centers computed
+ * from the AMR index of the cells instead of the origin of the patch, so that seeded loads give
+ * bitwise identical particles whatever the domain decomposition and the number of MPI ranks.
  */
 template<typename ParticleArray, typename GridLayout>
 class MaxwellianParticleInitializer : public ParticleInitializer<ParticleArray, GridLayout>
@@ -43,7 +56,9 @@ public:
                                   std::optional<std::size_t> seed = {},
                                   Basis basis                     = Basis::Cartesian,
                                   std::array<InputFunction, 3> magneticField
-                                  = {nullptr, nullptr, nullptr})
+                                  = {nullptr, nullptr, nullptr},
+                                  std::size_t nbrThreads = 1,
+                                  std::optional<std::array<double, dimension>> domainOrigin = {})
         : density_{density}
         , bulkVelocity_{bulkVelocity}
         , thermalVelocity_{thermalVelocity}
@@ -52,13 +67,14 @@ public:
         , nbrParticlePerCell_{nbrParticlesPerCell}
         , basis_{basis}
         , rngSeed_{seed}
+        , nbrThreads_{std::max(nbrThreads, std::size_t{1})}
+        , domainOrigin_{domainOrigin}
     {
     }
 
 
     /**
-     * @brief load pacore
-} // namespace PHARErticles in a ParticleArray in a domain defined by the given layout
+     * @brief load particles in a ParticleArray in a domain defined by the given layout
      */
     void loadParticles(ParticleArray& particles, GridLayout const& layout) const override;
 
@@ -89,6 +105,11 @@ private:
     std::uint32_t nbrParticlePerCell_;
     Basis basis_;
     std::optional<std::size_t> rngSeed_;
+    std::size_t nbrThreads_;
+    std::optional<std::array<double, dimension>> domainOrigin_;
+
+    // below this number of particles per thread, threads cost more than they save
+    static constexpr std::size_t minParticlesPerThread_ = 1 << 14;
 };
 
 
@@ -144,27 +165,36 @@ void MaxwellianParticleInitializer<ParticleArray, GridLayout>::loadParticles(
     };
 
 
-    auto deltas = [](auto& pos, auto& gen) -> std::array<float, dimension> {
-        if constexpr (dimension == 1)
-            return {pos(gen)};
-        if constexpr (dimension == 2)
-            return {pos(gen), pos(gen)};
-        if constexpr (dimension == 3)
-            return {pos(gen), pos(gen), pos(gen)};
-    };
-
-
     // in the following two calls,
     // primal indexes are given here because that's what cellCenteredCoordinates takes
 
     // indices = std::vector<std::tuple<std::uint32_t, per dim>>
     auto ndCellIndices = layout.physicalStartToEndIndices(QtyCentering::primal);
 
+    // cell centers computed from the AMR index, the same for a cell whatever its patch
+    auto amrCellCoords = [&]() {
+        auto coords  = tuple_fixed_type<std::vector<double>, dimension>{};
+        auto vectors = std::apply(
+            [](auto&... v) { return std::array<std::vector<double>*, dimension>{&v...}; }, coords);
+        auto const meshSize = layout.meshSize();
+        for (std::size_t i = 0; i < ndCellIndices.size(); ++i)
+        {
+            auto const AMRCellIndex = layout.localToAMR(point(i, ndCellIndices));
+            for (std::size_t iDir = 0; iDir < dimension; ++iDir)
+                vectors[iDir]->push_back((*domainOrigin_)[iDir]
+                                         + (AMRCellIndex[iDir] + 0.5) * meshSize[iDir]);
+        }
+        return coords;
+    };
+
     // coords = std::tuple<std::vector<double>,  per dim>
-    auto cellCoords = layout.indexesToCoordVectors(
-        ndCellIndices, QtyCentering::primal, [](auto const& gridLayout, auto const&... indexes) {
-            return gridLayout.cellCenteredCoordinates(indexes...);
-        });
+    auto cellCoords = domainOrigin_
+                          ? amrCellCoords()
+                          : layout.indexesToCoordVectors(
+                              ndCellIndices, QtyCentering::primal,
+                              [](auto const& gridLayout, auto const&... indexes) {
+                                  return gridLayout.cellCenteredCoordinates(indexes...);
+                              });
 
     auto const fns = std::make_from_tuple<MaxwellianInitFunctions>(std::tuple_cat(
         std::forward_as_tuple(density_, bulkVelocity_, thermalVelocity_, magneticField_, basis_),
@@ -172,37 +202,75 @@ void MaxwellianParticleInitializer<ParticleArray, GridLayout>::loadParticles(
 
     auto const [n, V, Vth] = fns();
     auto const cellVolume  = layout.cellVolume();
-    auto randGen           = getRNG(rngSeed_);
-    ParticleDeltaDistribution deltaDistrib;
+    auto const nbrCells    = ndCellIndices.size();
+    auto const meshSize    = layout.meshSize();
 
-    for (std::size_t flatCellIdx = 0; flatCellIdx < ndCellIndices.size(); flatCellIdx++)
-    {
-        auto const cellWeight   = n[flatCellIdx] * cellVolume / nbrParticlePerCell_;
-        auto const AMRCellIndex = layout.localToAMR(point(flatCellIdx, ndCellIndices));
+    // without a seed, particles only need to differ from one run to the other
+    std::uint64_t const seed = rngSeed_ ? *rngSeed_ : std::random_device{}() * 0x100000001ULL;
+
+    // all the particles are loaded in place, after those already in the array
+    auto const first = particles.size();
+    particles.resize(first + nbrCells * nbrParticlePerCell_);
 
-        std::array<double, 3> particleVelocity;
+    // draws of a cell: 3 normals per particle for velocities, then the deltas from deltaCounter
+    std::uint64_t const deltaCounter = 3 * std::uint64_t{nbrParticlePerCell_} + 1;
+
+    auto loadCells = [&](std::size_t firstCell, std::size_t endCell) {
+        std::vector<double> normals(3 * nbrParticlePerCell_);
         std::array<std::array<double, 3>, 3> basis;
 
-        if (basis_ == Basis::Magnetic)
+        for (std::size_t flatCellIdx = firstCell; flatCellIdx < endCell; flatCellIdx++)
         {
-            auto const B = fns.B();
-            localMagneticBasis({B[0][flatCellIdx], B[1][flatCellIdx], B[2][flatCellIdx]}, basis);
-        }
+            auto const cellWeight   = n[flatCellIdx] * cellVolume / nbrParticlePerCell_;
+            auto const AMRCellIndex = layout.localToAMR(point(flatCellIdx, ndCellIndices));
+            auto const iCell        = AMRCellIndex.template toArray<int>();
 
-        for (std::uint32_t ipart = 0; ipart < nbrParticlePerCell_; ++ipart)
-        {
-            maxwellianVelocity({V[0][flatCellIdx], V[1][flatCellIdx], V[2][flatCellIdx]},
-                               {Vth[0][flatCellIdx], Vth[1][flatCellIdx], Vth[2][flatCellIdx]}, //
-                               randGen, particleVelocity);
+            auto const rng = std::apply(
+                [&](auto const... index) { return CounterRNG{seed, meshSize[0], index...}; },
+                iCell);
 
             if (basis_ == Basis::Magnetic)
-                particleVelocity = basisTransform(basis, particleVelocity);
-
-            particles.emplace_back(Particle{cellWeight, particleCharge_,
-                                            AMRCellIndex.template toArray<int>(),
-                                            deltas(deltaDistrib, randGen), particleVelocity});
+            {
+                auto const B = fns.B();
+                localMagneticBasis({B[0][flatCellIdx], B[1][flatCellIdx], B[2][flatCellIdx]},
+                                   basis);
+            }
+
+            rng.normals(0, normals.data(), normals.size());
+
+            for (std::uint32_t ipart = 0; ipart < nbrParticlePerCell_; ++ipart)
+            {
+                std::array<double, 3> particleVelocity;
+                for (std::size_t i = 0; i < 3; ++i)
+                    particleVelocity[i]
+                        = V[i][flatCellIdx] + Vth[i][flatCellIdx] * normals[3 * ipart + i];
+
+                if (basis_ == Basis::Magnetic)
+                    particleVelocity = basisTransform(basis, particleVelocity);
+
+                std::array<float, dimension> delta;
+                for (std::size_t i = 0; i < dimension; ++i)
+                    delta[i] = rng.uniformFloat(deltaCounter + dimension * ipart + i);
+
+                particles[first + flatCellIdx * nbrParticlePerCell_ + ipart]
+                    = Particle{cellWeight, particleCharge_, iCell, delta, particleVelocity};
+            }
         }
-    }
+    };
+
+    auto const nbrParticles = nbrCells * nbrParticlePerCell_;
+    auto const nbrThreads
+        = std::min(nbrThreads_, std::max(nbrParticles / minParticlesPerThread_, std::size_t{1}));
+    if (nbrThreads == 1)
+        return loadCells(0, nbrCells);
+
+    // input functions were evaluated above, threads only draw and fill their cells
+    std::vector<std::thread> threads;
+    for (std::size_t iThread = 0; iThread < nbrThreads; ++iThread)
+        threads.emplace_back(loadCells, iThread * nbrCells / nbrThreads,
+                             (iThread + 1) * nbrCells / nbrThreads);
+    for (auto& thread : threads)
+        thread.join();
 }
 
 } // namespace PHARE::core
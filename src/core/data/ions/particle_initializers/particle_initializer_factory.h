@@ -3,16 +3,46 @@
 
 
 #include "core/utilities/types.h"
+#include "core/utilities/mpi_utils.h"
 #include "initializer/data_provider.h"
 #include "maxwellian_particle_initializer.h"
 #include "particle_initializer.h"
 
+#include <array>
 #include <memory>
+#include <random>
+#include <optional>
+#include <stdexcept>
 
 namespace PHARE
 {
 namespace core
 {
+    /*
+     * decomposition independent loads need a seed common to all ranks. Unseeded populations are
+     * given rank 0's seed once, when the simulation is set up, the factory being called for each
+     * patch and ranks not owning the same number of patches. It must be called on all ranks.
+     */
+    inline void resolveParticleSeeds(initializer::PHAREDict& ions)
+    {
+        auto const nbrPopulations = ions["nbrPopulations"].template to<int>();
+        for (int ipop = 0; ipop < nbrPopulations; ++ipop)
+        {
+            auto& info = ions["pop" + std::to_string(ipop)]["particle_initializer"];
+            if (!info.contains("init") or !info["init"].contains("domain_origin"))
+                continue;
+
+            auto& init = info["init"];
+            if (init.contains("seed") and init["seed"].template to<std::optional<std::size_t>>())
+                continue;
+
+            auto const seed = mpi::collect(std::size_t{std::random_device{}()})[0];
+            init["seed"]    = std::optional<std::size_t>{seed};
+        }
+    }
+
+
+
     template<typename ParticleArray, typename GridLayout>
     class ParticleInitializerFactory
     {
@@ -57,11 +87,34 @@ namespace core
                 if (dict.contains("init") && dict["init"].contains("seed"))
                     seed = dict["init"]["seed"].template to<std::optional<std::size_t>>();
 
+                std::size_t nbrThreads = 1;
+                if (dict.contains("init") && dict["init"].contains("threads"))
+                    nbrThreads = dict["init"]["threads"].template to<std::size_t>();
+
+                // loads independent of the domain decomposition need the origin of the domain,
+                // and a seed common to all ranks, see resolveParticleSeeds
+                std::optional<std::array<double, dimension>> domainOrigin;
+                if (dict.contains("init") && dict["init"].contains("domain_origin"))
+                {
+                    auto& origin           = dict["init"]["domain_origin"];
+                    std::string const axes = "xyz";
+                    domainOrigin           = std::array<double, dimension>{};
+                    for (std::size_t i = 0; i < dimension; ++i)
+                        (*domainOrigin)[i] = origin[std::string{axes[i]}].template to<double>();
+
+                    if (!seed)
+                        throw std::runtime_error(
+                            "Error: decomposition independent loads need a seed common to all "
+                            "ranks, see resolveParticleSeeds");
+                }
+
                 if (basisName == "cartesian")
                 {
                     return std::make_unique<
                         MaxwellianParticleInitializer<ParticleArray, GridLayout>>(
-                        density, v, vth, charge, nbrPartPerCell, seed);
+                        density, v, vth, charge, nbrPartPerCell, seed, Basis::Cartesian,
+                        std::array<FunctionType, 3>{nullptr, nullptr, nullptr}, nbrThreads,
+                        domainOrigin);
                 }
                 else if (basisName == "magnetic")
                 {
@@ -72,7 +125,9 @@ namespace core
 
                     return std::make_unique<
                         MaxwellianParticleInitializer<ParticleArray, GridLayout>>(
-                        density, v, vth, charge, nbrPartPerCell, seed);
+                        density, v, vth, charge, nbrPartPerCell, seed, Basis::Cartesian,
+                        std::array<FunctionType, 3>{nullptr, nullptr, nullptr}, nbrThreads,
+                        domainOrigin);
                 }
             }
             // TODO throw?
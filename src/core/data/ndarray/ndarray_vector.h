@@ -7,6 +7,7 @@
 #include <vector>
 #include <tuple>
 #include <numeric>
+#include <algorithm>
 
 
 namespace PHARE::core
@@ -211,7 +212,7 @@ public:
     auto end() const { return std::end(data_); }
     auto end() { return std::end(data_); }
 
-    void zero() { data_ = std::vector<DataType>(data_.size(), {0}); }
+    void zero() { std::fill(std::begin(data_), std::end(data_), DataType{0}); }
 
 
     NdArrayVector& operator=(NdArrayVector const& source)
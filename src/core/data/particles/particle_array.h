@@ -66,6 +66,9 @@ public:
 
     void swap(ParticleArray<dim>& that) { std::swap(this->particles, that.particles); }
 
+    //! replaces the content of this array by the one of source, reusing the current capacity
+    void copyData(ParticleArray<dim> const& source) { particles = source.particles; }
+
 private:
     Vector particles;
 };
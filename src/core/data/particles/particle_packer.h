@@ -37,25 +37,37 @@ public:
     bool hasNext() const { return it_ < particles_.size(); }
     auto next() { return get(it_++); }
 
-    void pack(ContiguousParticles<dim>& copy)
+    // copy holds at least start + particles.size() particles, they are packed from index start
+    void pack(ContiguousParticles<dim>& copy, std::size_t start = 0)
+    {
+        std::size_t idx = start;
+        while (this->hasNext())
+            pack_(copy, idx++, this->next());
+    }
+
+    // only packs the particles of the given indexes, in that order
+    void pack(ContiguousParticles<dim>& copy, std::vector<std::size_t> const& indexes,
+              std::size_t start = 0)
+    {
+        std::size_t idx = start;
+        for (auto index : indexes)
+            pack_(copy, idx++, get(index));
+    }
+
+private:
+    template<typename Particle>
+    static void pack_(ContiguousParticles<dim>& copy, std::size_t idx, Particle const& particle)
     {
         auto copyTo = [](auto& a, auto& idx, auto size, auto& v) {
             std::copy(a.begin(), a.begin() + size, v.begin() + (idx * size));
         };
-        std::size_t idx = 0;
-        while (this->hasNext())
-        {
-            auto next        = this->next();
-            copy.weight[idx] = std::get<0>(next);
-            copy.charge[idx] = std::get<1>(next);
-            copyTo(std::get<2>(next), idx, dim, copy.iCell);
-            copyTo(std::get<3>(next), idx, dim, copy.delta);
-            copyTo(std::get<4>(next), idx, 3, copy.v);
-            idx++;
-        }
+        copy.weight[idx] = std::get<0>(particle);
+        copy.charge[idx] = std::get<1>(particle);
+        copyTo(std::get<2>(particle), idx, dim, copy.iCell);
+        copyTo(std::get<3>(particle), idx, dim, copy.delta);
+        copyTo(std::get<4>(particle), idx, 3, copy.v);
     }
 
-private:
     ParticleArray<dim> const& particles_;
     std::size_t it_ = 0;
     static inline std::array<std::string, 5> keys_{"weight", "charge", "iCell", "delta", "v"};
@@ -0,0 +1,224 @@
+#ifndef PHARE_CORE_LOGGER_H
+#define PHARE_CORE_LOGGER_H
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+
+#include "core/utilities/mpi_utils.h"
+
+/*
+ * Run log levels, PHARE_LOG_LEVEL is set at configure time (-DPHARE_LOG_LEVEL=N)
+ * and logging calls above that level are compiled out.
+ *
+ *  0 : no logging
+ *  1 : info, e.g. once per coarse time step
+ *  2 : debug, e.g. on every substep of every level
+ *
+ * The log is written by rank 0 only, one JSON object per line, to the standard output or to
+ * the file given to RunLog::open. Values of an event are those of rank 0, only the step summary
+ * is summed over the ranks. Errors that cannot be thrown are written by any rank, see
+ * RunLog::error.
+ */
+#ifndef PHARE_LOG_LEVEL
+#define PHARE_LOG_LEVEL 0
+#endif
+
+#define PHARE_LOG_INFO 1
+#define PHARE_LOG_DEBUG 2
+
+// e.g. PHARE_LOG(PHARE_LOG_DEBUG, core::LogEntry{"advanceLevel"}("level", iLevel)("dt", dt))
+#define PHARE_LOG(level, entry)                                                                    \
+    do                                                                                             \
+    {                                                                                              \
+        if constexpr (PHARE_LOG_LEVEL >= level)                                                    \
+            PHARE::core::RunLog::INSTANCE().write(entry);                                          \
+    } while (0)
+
+
+namespace PHARE::core
+{
+/*
+ * one line of the run log, {"event": name} followed by the (key, value) given with operator()
+ * numbers, booleans, strings and vectors of numbers are supported, strings, keys and the event
+ * name being escaped
+ */
+class LogEntry
+{
+public:
+    explicit LogEntry(std::string const& event)
+    {
+        line_.precision(12);
+        line_ << "{\"event\": ";
+        writeString_(event);
+    }
+
+    template<typename Value>
+    LogEntry& operator()(std::string const& key, Value const& value)
+    {
+        line_ << ", ";
+        writeString_(key);
+        line_ << ": ";
+        write_(value);
+        return *this;
+    }
+
+    std::string str() const { return line_.str() + "}"; }
+
+
+private:
+    template<typename Value>
+    void write_(Value const& value)
+    {
+        if constexpr (std::is_same_v<Value, bool>)
+            line_ << (value ? "true" : "false");
+        else if constexpr (std::is_arithmetic_v<Value>)
+            line_ << value;
+        else if constexpr (std::is_convertible_v<Value, std::string>)
+            writeString_(std::string{value});
+        else
+        {
+            line_ << "[";
+            for (std::size_t i = 0; i < value.size(); ++i)
+            {
+                line_ << (i ? ", " : "");
+                write_(value[i]);
+            }
+            line_ << "]";
+        }
+    }
+
+    // quoted JSON string, quotes, backslashes and control characters escaped
+    void writeString_(std::string const& string)
+    {
+        line_ << '"';
+        for (char const c : string)
+        {
+            switch (c)
+            {
+                case '"': line_ << "\\\""; break;
+                case '\\': line_ << "\\\\"; break;
+                case '\n': line_ << "\\n"; break;
+                case '\t': line_ << "\\t"; break;
+                case '\r': line_ << "\\r"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                        line_ << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                              << static_cast<int>(c) << std::dec << std::setfill(' ');
+                    else
+                        line_ << c;
+            }
+        }
+        line_ << '"';
+    }
+
+    std::ostringstream line_;
+};
+
+
+
+class RunLog
+{
+public:
+    static RunLog& INSTANCE()
+    {
+        static RunLog log;
+        return log;
+    }
+
+
+    // on rank 0, writes the log to path instead of the standard output
+    void open(std::string const& path)
+    {
+        if (mpi::rank() != 0)
+            return;
+        file_.open(path, std::ios::app);
+        if (!file_)
+            throw std::runtime_error("Error: cannot open run log " + path);
+    }
+
+
+    void write(LogEntry const& entry)
+    {
+        if (mpi::rank() != 0)
+            return;
+        auto& out = file_.is_open() ? static_cast<std::ostream&>(file_) : std::cout;
+        out << entry.str() << "\n";
+    }
+
+
+    /*
+     * writes an error that cannot be thrown, e.g. from a destructor, whatever the rank it
+     * happens on, to the log file if open, to the standard error otherwise
+     */
+    void error(LogEntry const& entry)
+    {
+        auto& out = file_.is_open() ? static_cast<std::ostream&>(file_) : std::cerr;
+        out << entry.str() << std::endl;
+    }
+
+
+    /*
+     * adds the particles pushed and the cells updated on this rank to the level counters
+     * they are kept per rank until the next step summary
+     */
+    void count(int level, std::size_t particles, std::size_t cells)
+    {
+        auto const nbrLevels = static_cast<std::size_t>(level) + 1;
+        if (particles_.size() < nbrLevels)
+        {
+            particles_.resize(nbrLevels, 0);
+            cells_.resize(nbrLevels, 0);
+        }
+        particles_[level] += particles;
+        cells_[level] += cells;
+    }
+
+
+    /*
+     * sums the level counters over the ranks, writes the particles pushed and the cells updated
+     * per second during the step that took the given number of seconds, and resets the counters.
+     * Must be called by all ranks.
+     */
+    void stepSummary(std::size_t step, double time, double seconds)
+    {
+        auto const nbrLevels = static_cast<std::size_t>(mpi::max(particles_.size()));
+        particles_.resize(nbrLevels, 0);
+        cells_.resize(nbrLevels, 0);
+
+        auto const particles = mpi::sum(particles_);
+        auto const cells     = mpi::sum(cells_);
+        auto const nbrParticles
+            = std::accumulate(std::begin(particles), std::end(particles), std::size_t{0});
+        auto const nbrCells = std::accumulate(std::begin(cells), std::end(cells), std::size_t{0});
+
+        write(LogEntry{"step"}("step", step)("time", time)("seconds", seconds)(
+            "particles", nbrParticles)("cells", nbrCells)("level_particles", particles)(
+            "level_cells", cells)("particles_per_second", nbrParticles / seconds)(
+            "cells_per_second", nbrCells / seconds));
+
+        std::fill(std::begin(particles_), std::end(particles_), 0);
+        std::fill(std::begin(cells_), std::end(cells_), 0);
+    }
+
+
+private:
+    RunLog() = default;
+
+    std::ofstream file_;
+    std::vector<std::size_t> particles_;
+    std::vector<std::size_t> cells_;
+};
+
+} // namespace PHARE::core
+
+
+#endif /* PHARE_CORE_LOGGER_H */
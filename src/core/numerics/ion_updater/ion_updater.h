@@ -10,6 +10,7 @@
 #include "core/numerics/moments/moments.h"
 
 #include "core/data/ions/ions.h"
+#include "core/timers.h"
 
 #include "initializer/data_provider.h"
 
@@ -141,10 +142,17 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateMomentsOnly_(Ions& ions, El
             = makeRange(std::begin(pop.domainParticles()), std::end(pop.domainParticles()));
         auto outRange = makeRange(std::begin(tmpDomain), std::end(tmpDomain));
 
-        auto newEnd
-            = pusher_->move(inRange, outRange, em, pop.mass(), interpolator_, inDomainBox, layout);
+        auto newEnd = [&]() {
+            PHARE_TIMER_SCOPE("push");
+            PHARE_COUNT("particles", pop.domainParticles().size());
+            return pusher_->move(inRange, outRange, em, pop.mass(), interpolator_, inDomainBox,
+                                 layout);
+        }();
 
-        interpolator_(std::begin(tmpDomain), newEnd, pop.density(), pop.flux(), layout);
+        {
+            PHARE_TIMER_SCOPE("deposit");
+            interpolator_(std::begin(tmpDomain), newEnd, pop.density(), pop.flux(), layout);
+        }
 
 
         // then push patch and level ghost particles
@@ -158,11 +166,16 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateMomentsOnly_(Ions& ions, El
             inRange  = makeRange(std::begin(inputArray), std::end(inputArray));
             outRange = makeRange(std::begin(outputArray), std::end(outputArray));
 
-            auto firstGhostOut = pusher_->move(inRange, outRange, em, pop.mass(), interpolator_,
-                                               ghostSelector, layout);
+            auto firstGhostOut = [&]() {
+                PHARE_TIMER_SCOPE("push");
+                PHARE_COUNT("particles", inputArray.size());
+                return pusher_->move(inRange, outRange, em, pop.mass(), interpolator_,
+                                     ghostSelector, layout);
+            }();
 
             auto endInDomain = std::partition(firstGhostOut, std::end(outputArray), inDomainBox);
 
+            PHARE_TIMER_SCOPE("deposit");
             interpolator_(firstGhostOut, endInDomain, pop.density(), pop.flux(), layout);
         };
 
@@ -206,13 +219,19 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateAll_(Ions& ions, Electromag
 
         auto domainPartRange = makeRange(std::begin(domainParticles), std::end(domainParticles));
 
-        auto firstOutside = pusher_->move(domainPartRange, domainPartRange, em, pop.mass(),
-                                          interpolator_, inDomainSelector, layout);
+        auto firstOutside = [&]() {
+            PHARE_TIMER_SCOPE("push");
+            PHARE_COUNT("particles", domainParticles.size());
+            return pusher_->move(domainPartRange, domainPartRange, em, pop.mass(), interpolator_,
+                                 inDomainSelector, layout);
+        }();
 
         domainParticles.erase(firstOutside, std::end(domainParticles));
 
 
         auto pushAndCopyInDomain = [&](auto& particleArray) {
+            PHARE_TIMER_SCOPE("push");
+            PHARE_COUNT("particles", particleArray.size());
             auto range = makeRange(std::begin(particleArray), std::end(particleArray));
             auto firstOutGhostBox
                 = pusher_->move(range, range, em, pop.mass(), interpolator_, ghostSelector, layout);
@@ -227,6 +246,7 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateAll_(Ions& ions, Electromag
         pushAndCopyInDomain(pop.patchGhostParticles());
         pushAndCopyInDomain(pop.levelGhostParticles());
 
+        PHARE_TIMER_SCOPE("deposit");
         interpolator_(std::begin(domainParticles), std::end(domainParticles), pop.density(),
                       pop.flux(), layout);
     }
@@ -33,31 +33,59 @@ namespace core
     };
 
 
+    template<typename Population>
+    auto& particlesToDeposit(Population& pop, DomainDeposit)
+    {
+        return pop.domainParticles();
+    }
+
+    template<typename Population>
+    auto& particlesToDeposit(Population& pop, PatchGhostDeposit)
+    {
+        return pop.patchGhostParticles();
+    }
+
+    template<typename Population>
+    auto& particlesToDeposit(Population& pop, LevelGhostDeposit)
+    {
+        return pop.levelGhostParticlesOld();
+    }
+
+
     template<typename Ions, typename GridLayout, typename DepositTag>
     void depositParticles(Ions& ions, GridLayout& layout,
                           Interpolator<GridLayout::dimension, GridLayout::interp_order> interpolate,
                           DepositTag)
+    {
+        for (auto& pop : ions)
+        {
+            auto& partArray = particlesToDeposit(pop, DepositTag{});
+            interpolate(std::begin(partArray), std::end(partArray), pop.density(), pop.flux(),
+                        layout);
+        }
+    }
+
+
+    /*
+     * resets the moments of each population and deposits all the particle arrays given by the
+     * tags, in a single pass over the populations, with the given interpolator
+     */
+    template<typename Ions, typename GridLayout, typename... DepositTags>
+    void resetAndDepositParticles(
+        Ions& ions, GridLayout const& layout,
+        Interpolator<GridLayout::dimension, GridLayout::interp_order>& interpolate, DepositTags...)
     {
         for (auto& pop : ions)
         {
             auto& density = pop.density();
             auto& flux    = pop.flux();
+            density.zero();
+            flux.zero();
 
-            if constexpr (std::is_same_v<DepositTag, DomainDeposit>)
-            {
-                auto& partArray = pop.domainParticles();
-                interpolate(std::begin(partArray), std::end(partArray), density, flux, layout);
-            }
-            else if constexpr (std::is_same_v<DepositTag, PatchGhostDeposit>)
-            {
-                auto& partArray = pop.patchGhostParticles();
-                interpolate(std::begin(partArray), std::end(partArray), density, flux, layout);
-            }
-            else if constexpr (std::is_same_v<DepositTag, LevelGhostDeposit>)
-            {
-                auto& partArray = pop.levelGhostParticlesOld();
+            auto deposit = [&](auto& partArray) {
                 interpolate(std::begin(partArray), std::end(partArray), density, flux, layout);
-            }
+            };
+            (deposit(particlesToDeposit(pop, DepositTags{})), ...);
         }
     }
 
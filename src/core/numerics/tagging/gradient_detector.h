@@ -0,0 +1,273 @@
+#ifndef PHARE_CORE_NUMERICS_TAGGING_GRADIENT_DETECTOR_H
+#define PHARE_CORE_NUMERICS_TAGGING_GRADIENT_DETECTOR_H
+
+#include <array>
+#include <cmath>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <stdexcept>
+
+#include "core/data/grid/gridlayoutdefs.h"
+#include "core/data/grid/gridlayout_utils.h"
+#include "core/data/ndarray/ndarray_vector.h"
+#include "core/data/vecfield/vecfield_component.h"
+
+#include "initializer/data_provider.h"
+
+
+namespace PHARE::core
+{
+/**
+ * @brief GradientDetector computes, for each physical cell of a patch, whether the cell should be
+ * refined. A cell is tagged as soon as one of the following criteria exceeds its threshold:
+ *
+ * - grad_B       : max_d dx_d |d_d B| / |B|, the relative magnetic field jump across the cell
+ * - current      : dx |J| / |B|, the magnetic field jump across the cell due to the current,
+ *                  dx being the largest mesh size, so that the threshold does not depend on the
+ *                  normalization of the fields
+ * - density_jump : max_d dx_d |d_d rho| / rho, the relative ion density jump across the cell
+ *
+ * A criterion is disabled if its threshold is absent from the dictionary or not strictly
+ * positive. All quantities are reconstructed at cell centers, whatever their centering.
+ */
+template<typename GridLayout>
+class GradientDetector : public LayoutHolder<GridLayout>
+{
+    static constexpr auto dimension = GridLayout::dimension;
+
+public:
+    using tags_type = NdArrayVector<dimension, int>;
+
+    GradientDetector() = default;
+
+    GradientDetector(PHARE::initializer::PHAREDict& dict)
+        : gradBThreshold_{threshold_(dict, "grad_B")}
+        , currentThreshold_{threshold_(dict, "current")}
+        , densityJumpThreshold_{threshold_(dict, "density_jump")}
+    {
+    }
+
+
+    bool active() const
+    {
+        return gradBThreshold_ > 0 || currentThreshold_ > 0 || densityJumpThreshold_ > 0;
+    }
+
+
+    /**
+     * @brief returns an array of nbrCells() tags, one per physical cell of the patch, set to 1
+     * where at least one criterion exceeds its threshold, 0 elsewhere.
+     *
+     * Each quantity is reconstructed at all cell centers before the criteria are evaluated, one
+     * contiguous row of cells after the other, so that the inner loops vectorize.
+     */
+    template<typename VecField, typename Field>
+    tags_type operator()(VecField const& B, VecField const& J, Field const& density) const
+    {
+        if (!this->hasLayout())
+            throw std::runtime_error(
+                "Error - GradientDetector - GridLayout not set, cannot proceed to tagging");
+
+        tags_type tags{this->layout_->nbrCells()};
+
+        auto const meshSize = this->layout_->meshSize();
+        auto const dx       = *std::max_element(meshSize.begin(), meshSize.end());
+        auto const size     = tags.size();
+        auto tag            = tags.begin();
+
+        std::vector<double> norm(size), value(size), jump(size);
+
+        if (gradBThreshold_ > 0 || currentThreshold_ > 0)
+        {
+            norm_(B, noDerivative, norm, value);
+
+            if (gradBThreshold_ > 0)
+                for (int iDir = 0; iDir < static_cast<int>(dimension); ++iDir)
+                {
+                    norm_(B, iDir, jump, value);
+                    for (std::size_t i = 0; i < size; ++i)
+                        tag[i] |= norm[i] > 0 && jump[i] > gradBThreshold_ * norm[i];
+                }
+
+            if (currentThreshold_ > 0)
+            {
+                norm_(J, noDerivative, jump, value);
+                for (std::size_t i = 0; i < size; ++i)
+                    tag[i] |= norm[i] > 0 && dx * jump[i] > currentThreshold_ * norm[i];
+            }
+        }
+
+        if (densityJumpThreshold_ > 0)
+        {
+            auto& rho = norm;
+            reconstruct_(density, noDerivative, rho);
+            for (int iDir = 0; iDir < static_cast<int>(dimension); ++iDir)
+            {
+                reconstruct_(density, iDir, jump);
+                for (std::size_t i = 0; i < size; ++i)
+                    tag[i] |= rho[i] > 0 && std::abs(jump[i]) > densityJumpThreshold_ * rho[i];
+            }
+        }
+
+        return tags;
+    }
+
+
+private:
+    static constexpr int noDerivative      = -1;
+    static constexpr std::size_t nbrPoints = 1u << dimension;
+
+    /*
+     * stencil reconstructing a field, or its undivided derivative, at the center of local physical
+     * cell (i, j, k): sum_p coef[p] * field.data()[first + offset[p]], first being the flat
+     * index of node (i, j, k) from the physical start index, so that the stencil is the same for
+     * all cells and consecutive cells of a row read consecutive nodes
+     */
+    struct Stencil
+    {
+        std::array<std::ptrdiff_t, nbrPoints> offset;
+        std::array<double, nbrPoints> coef;
+        std::array<std::size_t, dimension> stride; // of the field data
+        std::size_t start;                         // flat index of the physical start node
+    };
+
+
+    static double threshold_(PHARE::initializer::PHAREDict& dict, std::string const& key)
+    {
+        if (dict.contains(key))
+            return dict[key].template to<double>();
+        return 0.;
+    }
+
+
+
+    /**
+     * @brief stencil_ returns the stencil of the field, derived in direction derivDir, or not
+     * if derivDir is noDerivative. Along each direction, the value or the undivided derivative
+     * (dx * d/dx) at the center of a cell needs two nodes, of either centering.
+     */
+    template<typename Field>
+    Stencil stencil_(Field const& field, int derivDir) const
+    {
+        auto const centerings = GridLayout::centering(field.physicalQuantity());
+        auto const shape      = field.shape();
+
+        Stencil stencil;
+        std::array<std::array<std::ptrdiff_t, 2>, dimension> offsets;
+        std::array<std::array<double, 2>, dimension> coefs;
+
+        std::size_t stride = 1;
+        stencil.start      = 0;
+        for (int iDir = static_cast<int>(dimension) - 1; iDir >= 0; --iDir)
+        {
+            auto const derivative = iDir == derivDir;
+            if (centerings[iDir] == QtyCentering::primal)
+            {
+                // cell 'cell' spans nodes start+cell and start+cell+1
+                offsets[iDir] = {0, 1};
+                coefs[iDir]   = derivative ? std::array<double, 2>{-1., 1.}
+                                           : std::array<double, 2>{0.5, 0.5};
+            }
+            else
+            {
+                // dual node start+cell is the center of cell 'cell', dual fields have ghost nodes
+                offsets[iDir] = derivative ? std::array<std::ptrdiff_t, 2>{-1, 1}
+                                           : std::array<std::ptrdiff_t, 2>{0, 0};
+                coefs[iDir]   = derivative ? std::array<double, 2>{-0.5, 0.5}
+                                           : std::array<double, 2>{0.5, 0.5};
+            }
+
+            auto const start
+                = this->layout_->physicalStartIndex(field, static_cast<Direction>(iDir));
+            stencil.stride[iDir] = stride;
+            stencil.start += start * stride;
+            stride *= shape[iDir];
+        }
+
+        for (std::size_t p = 0; p < nbrPoints; ++p)
+        {
+            stencil.offset[p] = 0;
+            stencil.coef[p]   = 1.;
+            for (std::size_t iDir = 0; iDir < dimension; ++iDir)
+            {
+                auto const bit    = (p >> (dimension - 1 - iDir)) & 1u;
+                auto const stride = static_cast<std::ptrdiff_t>(stencil.stride[iDir]);
+                stencil.offset[p] += offsets[iDir][bit] * stride;
+                stencil.coef[p] *= coefs[iDir][bit];
+            }
+        }
+
+        return stencil;
+    }
+
+
+
+    /**
+     * @brief reconstruct_ sets values, laid out as the tags, to the field, or its undivided
+     * derivative in direction derivDir, at the center of each physical cell.
+     */
+    template<typename Field>
+    void reconstruct_(Field const& field, int derivDir, std::vector<double>& values) const
+    {
+        auto const stencil = stencil_(field, derivDir);
+        auto const cells   = this->layout_->nbrCells();
+        auto const rowSize = cells[dimension - 1];
+        auto const* data   = field.data();
+
+        // a row of cells along the last direction, starting at the given flat node index
+        auto row = [&](std::size_t first, double* out) {
+            for (std::uint32_t i = 0; i < rowSize; ++i)
+            {
+                double value = 0.;
+                for (std::size_t p = 0; p < nbrPoints; ++p)
+                    value += stencil.coef[p] * data[first + i + stencil.offset[p]];
+                out[i] = value;
+            }
+        };
+
+        auto* out = values.data();
+        if constexpr (dimension == 1)
+            row(stencil.start, out);
+        if constexpr (dimension == 2)
+        {
+            for (std::uint32_t ix = 0; ix < cells[0]; ++ix, out += rowSize)
+                row(stencil.start + ix * stencil.stride[0], out);
+        }
+        if constexpr (dimension == 3)
+        {
+            for (std::uint32_t ix = 0; ix < cells[0]; ++ix)
+                for (std::uint32_t iy = 0; iy < cells[1]; ++iy, out += rowSize)
+                    row(stencil.start + ix * stencil.stride[0] + iy * stencil.stride[1], out);
+        }
+    }
+
+
+
+    // norms of the vector field, or of its undivided derivative, at cell centers
+    template<typename VecField>
+    void norm_(VecField const& v, int derivDir, std::vector<double>& norms,
+               std::vector<double>& component) const
+    {
+        std::fill(std::begin(norms), std::end(norms), 0.);
+        for (auto componentName : {Component::X, Component::Y, Component::Z})
+        {
+            reconstruct_(v.getComponent(componentName), derivDir, component);
+            for (std::size_t i = 0; i < norms.size(); ++i)
+                norms[i] += component[i] * component[i];
+        }
+        for (auto& norm : norms)
+            norm = std::sqrt(norm);
+    }
+
+
+
+    double gradBThreshold_       = 0.;
+    double currentThreshold_     = 0.;
+    double densityJumpThreshold_ = 0.;
+};
+
+} // namespace PHARE::core
+
+#endif
@@ -0,0 +1,190 @@
+#ifndef PHARE_CORE_TIMERS_H
+#define PHARE_CORE_TIMERS_H
+
+#include <map>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <numeric>
+#include <algorithm>
+
+#include "core/utilities/mpi_utils.h"
+
+/*
+ * Timers and counters, PHARE_TIMERS is set at configure time (-DPHARE_TIMERS=1), timing and
+ * counting calls are compiled out otherwise.
+ *
+ * PHARE_TIMER_SCOPE(name) times the rest of the enclosing scope, nested in the scope timed by
+ * the innermost enclosing timer, if any, and PHARE_TIMER_LEVEL_SCOPE(name, level) does the same
+ * for a scope done per level of the hierarchy. PHARE_COUNT(name, n) adds n to a counter of the
+ * innermost timed scope, e.g. the number of particles pushed.
+ *
+ * Timers are not thread safe, they are only meant for the thread running the simulation.
+ */
+#ifndef PHARE_TIMERS
+#define PHARE_TIMERS 0
+#endif
+
+#define PHARE_TIMER_CONCAT_(a, b) a##b
+#define PHARE_TIMER_NAME_(line) PHARE_TIMER_CONCAT_(phare_scope_timer_, line)
+
+#if PHARE_TIMERS
+#define PHARE_TIMER_SCOPE(name) PHARE::core::ScopeTimer PHARE_TIMER_NAME_(__LINE__){name}
+#define PHARE_TIMER_LEVEL_SCOPE(name, level)                                                       \
+    PHARE::core::ScopeTimer PHARE_TIMER_NAME_(__LINE__){name, level}
+#define PHARE_COUNT(name, n) PHARE::core::Timers::INSTANCE().count(name, n)
+#else
+#define PHARE_TIMER_SCOPE(name)
+#define PHARE_TIMER_LEVEL_SCOPE(name, level)
+#define PHARE_COUNT(name, n)
+#endif
+
+
+namespace PHARE::core
+{
+class Timers
+{
+public:
+    struct Node
+    {
+        double seconds    = 0;
+        std::size_t calls = 0;
+        std::size_t count = 0;
+        std::map<std::string, Node> children;
+    };
+
+    static Timers& INSTANCE()
+    {
+        static Timers timers;
+        return timers;
+    }
+
+
+    Node* enter(std::string const& name)
+    {
+        auto* parent = current_;
+        current_     = &parent->children[name];
+        return parent;
+    }
+
+    void exit(Node* parent, double seconds)
+    {
+        current_->seconds += seconds;
+        ++current_->calls;
+        current_ = parent;
+    }
+
+    void count(std::string const& name, std::size_t n) { current_->children[name].count += n; }
+
+
+    void reset()
+    {
+        root_    = Node{};
+        current_ = &root_;
+    }
+
+
+    /*
+     * writes, from rank 0, the number of calls and the min, average and max time over the ranks
+     * of each timed scope, with the total of its counter, one line per scope named by its path
+     */
+    void write(std::string const& path) const
+    {
+        std::stringstream local;
+        flatten_(root_, "", local);
+        auto const perRank = mpi::gather(local.str());
+        if (mpi::rank() != 0)
+            return;
+
+        struct Stats
+        {
+            std::vector<double> seconds;
+            std::size_t calls = 0;
+            std::size_t count = 0;
+        };
+        std::map<std::string, Stats> stats;
+
+        for (auto const& lines : perRank)
+        {
+            std::istringstream in{lines};
+            std::string scope;
+            double seconds;
+            std::size_t calls, count;
+            while (in >> scope >> calls >> seconds >> count)
+            {
+                auto& scopeStats = stats[scope];
+                scopeStats.seconds.push_back(seconds);
+                scopeStats.calls += calls;
+                scopeStats.count += count;
+            }
+        }
+
+        std::ofstream out{path};
+        out << "# " << perRank.size() << " ranks, times in seconds\n";
+        out << "# scope ranks calls min avg max count\n";
+        for (auto const& [scope, scopeStats] : stats)
+        {
+            auto const& seconds   = scopeStats.seconds;
+            auto const [min, max] = std::minmax_element(std::begin(seconds), std::end(seconds));
+            auto const sum        = std::accumulate(std::begin(seconds), std::end(seconds), 0.);
+            out << scope << " " << seconds.size() << " " << scopeStats.calls << " " << *min << " "
+                << sum / seconds.size() << " " << *max << " " << scopeStats.count << "\n";
+        }
+    }
+
+
+private:
+    Timers() = default;
+
+    static void flatten_(Node const& node, std::string const& path, std::ostream& out)
+    {
+        for (auto const& [name, child] : node.children)
+        {
+            auto const childPath = path.empty() ? name : path + "/" + name;
+            out << childPath << " " << child.calls << " " << child.seconds << " " << child.count
+                << "\n";
+            flatten_(child, childPath, out);
+        }
+    }
+
+    Node root_;
+    Node* current_ = &root_;
+};
+
+
+
+class ScopeTimer
+{
+public:
+    ScopeTimer(std::string const& name)
+        : parent_{Timers::INSTANCE().enter(name)}
+        , start_{std::chrono::steady_clock::now()}
+    {
+    }
+
+    // for a scope done per level, named name_L<level>
+    ScopeTimer(std::string const& name, int level)
+        : ScopeTimer{name + "_L" + std::to_string(level)}
+    {
+    }
+
+    ~ScopeTimer()
+    {
+        std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start_;
+        Timers::INSTANCE().exit(parent_, elapsed.count());
+    }
+
+    ScopeTimer(ScopeTimer const&) = delete;
+    ScopeTimer& operator=(ScopeTimer const&) = delete;
+
+private:
+    Timers::Node* parent_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace PHARE::core
+
+#endif /* PHARE_CORE_TIMERS_H */
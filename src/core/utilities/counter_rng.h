@@ -0,0 +1,93 @@
+#ifndef PHARE_CORE_UTILITIES_COUNTER_RNG_H
+#define PHARE_CORE_UTILITIES_COUNTER_RNG_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace PHARE::core
+{
+// SplitMix64 finalizer, maps a key to a uniformly distributed value
+inline std::uint64_t splitMix64(std::uint64_t bits)
+{
+    bits = (bits ^ (bits >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    bits = (bits ^ (bits >> 27)) * 0x94d049bb133111ebULL;
+    return bits ^ (bits >> 31);
+}
+
+
+/*
+ * CounterRNG is a counter-based random number generator: it has no state, draw i of a stream only
+ * depends on the key of the stream and on i. Streams keyed by what a draw is for (e.g. a seed, a
+ * cell and a particle) give the same numbers whatever the order they are drawn in, the thread
+ * drawing them or the domain decomposition.
+ * Draws are the SplitMix64 finalizer of the key plus the counter times the golden ratio.
+ */
+class CounterRNG
+{
+public:
+    // the key is the hash of the seed and of the bits of each of the keys
+    template<typename... Keys>
+    explicit CounterRNG(std::uint64_t seed, Keys const... keys)
+        : key_{splitMix64(seed)}
+    {
+        (combine_(keys), ...);
+    }
+
+    std::uint64_t operator()(std::uint64_t counter) const
+    {
+        return splitMix64(key_ + (counter + 1) * 0x9e3779b97f4a7c15ULL);
+    }
+
+    // in [0, 1)
+    double uniform(std::uint64_t counter) const
+    {
+        return static_cast<double>((*this)(counter) >> 11) * 0x1.0p-53;
+    }
+
+    // in [0, 1), exactly representable as a float, so that it never rounds to 1
+    float uniformFloat(std::uint64_t counter) const
+    {
+        return static_cast<float>((*this)(counter) >> 40) * 0x1.0p-24f;
+    }
+
+    /*
+     * fills normals with size standard normal draws, with the Box-Muller transform of the
+     * uniform draws of counters first to first + size, rounded up to an even number
+     */
+    void normals(std::uint64_t first, double* normals, std::size_t size) const
+    {
+        constexpr double twoPi = 6.283185307179586476925286766559;
+
+        std::size_t const nbrPairs = size / 2;
+        for (std::size_t i = 0; i < nbrPairs; ++i)
+        {
+            auto const radius = std::sqrt(-2. * std::log(1. - uniform(first + 2 * i)));
+            auto const angle  = twoPi * uniform(first + 2 * i + 1);
+            normals[2 * i]     = radius * std::cos(angle);
+            normals[2 * i + 1] = radius * std::sin(angle);
+        }
+        if (size % 2 == 1)
+        {
+            auto const radius  = std::sqrt(-2. * std::log(1. - uniform(first + 2 * nbrPairs)));
+            normals[size - 1] = radius * std::cos(twoPi * uniform(first + 2 * nbrPairs + 1));
+        }
+    }
+
+private:
+    template<typename Key>
+    void combine_(Key const key)
+    {
+        static_assert(sizeof(Key) <= sizeof(std::uint64_t));
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &key, sizeof(key));
+        key_ = splitMix64(key_ ^ bits);
+    }
+
+    std::uint64_t key_;
+};
+
+} // namespace PHARE::core
+
+#endif /* PHARE_CORE_UTILITIES_COUNTER_RNG_H */
@@ -1,5 +1,8 @@
 #include "mpi_utils.h"
 
+#include <limits>
+#include <stdexcept>
+
 namespace PHARE::core::mpi
 {
 int size()
@@ -10,6 +13,14 @@ int size()
 }
 
 
+int rank()
+{
+    int mpi_rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    return mpi_rank;
+}
+
+
 std::size_t max(std::size_t const local, int mpi_size)
 {
     if (mpi_size == 0)
@@ -18,4 +29,51 @@ std::size_t max(std::size_t const local, int mpi_size)
     auto perMPI = collect(local, mpi_size);
     return *std::max_element(std::begin(perMPI), std::end(perMPI));
 }
+
+
+// MPI counts are int, sizes are checked on all ranks so that they all throw
+static void checkCount_(std::uint64_t const size)
+{
+    if (size > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+        throw std::runtime_error("Error: " + std::to_string(size)
+                                 + " bytes are too many for a single MPI message");
+}
+
+
+std::string broadcast(std::string const& data, int root)
+{
+    std::uint64_t size = data.size();
+    MPI_Bcast(&size, 1, MPI_UINT64_T, root, MPI_COMM_WORLD);
+    checkCount_(size);
+
+    std::string bytes = rank() == root ? data : std::string(size, '\0');
+    MPI_Bcast(bytes.data(), static_cast<int>(size), MPI_CHAR, root, MPI_COMM_WORLD);
+    return bytes;
+}
+
+
+std::vector<std::string> gather(std::string const& data, int root)
+{
+    bool const isRoot  = rank() == root;
+    int const mpi_size = size();
+
+    std::uint64_t const localSize = data.size();
+    std::uint64_t totalSize       = 0;
+    MPI_Allreduce(&localSize, &totalSize, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    checkCount_(totalSize);
+
+    int const local = static_cast<int>(localSize);
+    std::vector<int> perRankSize(isRoot ? mpi_size : 0);
+    MPI_Gather(&local, 1, MPI_INT, perRankSize.data(), 1, MPI_INT, root, MPI_COMM_WORLD);
+
+    std::vector<int> const displs = core::displacementFrom(perRankSize);
+    std::string bytes(std::accumulate(perRankSize.begin(), perRankSize.end(), 0), '\0');
+    MPI_Gatherv(data.data(), local, MPI_CHAR, bytes.data(), perRankSize.data(), displs.data(),
+                MPI_CHAR, root, MPI_COMM_WORLD);
+
+    std::vector<std::string> perRank;
+    for (std::size_t i = 0; i < perRankSize.size(); ++i)
+        perRank.emplace_back(bytes.substr(displs[i], perRankSize[i]));
+    return perRank;
+}
 } // namespace PHARE::core::mpi
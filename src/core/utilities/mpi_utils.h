@@ -26,6 +26,14 @@ std::size_t max(std::size_t const local, int mpi_size = 0);
 
 int size();
 
+int rank();
+
+// returns the bytes of data on rank root, on all ranks
+std::string broadcast(std::string const& data, int root = 0);
+
+// returns the bytes of data of each rank on rank root, and nothing on the other ranks
+std::vector<std::string> gather(std::string const& data, int root = 0);
+
 template<typename Data, typename GatherFunc>
 void _gather(GatherFunc const&& gather)
 {
@@ -173,6 +181,19 @@ std::vector<Data> collect(Data const& data, int mpi_size)
         return values;
     }
 }
+
+
+// element wise sum over all MPI processes, the result is returned on all of them
+template<typename Data>
+std::vector<Data> sum(std::vector<Data> const& local)
+{
+    std::vector<Data> total(local.size());
+    _gather<Data>([&](auto mpi_type) {
+        MPI_Allreduce(local.data(), total.data(), local.size(), mpi_type, MPI_SUM,
+                      MPI_COMM_WORLD);
+    });
+    return total;
+}
 } // namespace PHARE::core::mpi
 
 
@@ -0,0 +1,97 @@
+#ifndef PHARE_DIAGNOSTIC_CHECKPOINT_MANAGER_H
+#define PHARE_DIAGNOSTIC_CHECKPOINT_MANAGER_H
+
+#include "initializer/data_provider.h"
+#include "initializer/restart_data_provider.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+namespace PHARE::diagnostic
+{
+class ICheckpointManager
+{
+public:
+    // writes a checkpoint of the model at timeStamp if timeStamp is the time step closest to
+    // a scheduled time, timeStep being the step that led to timeStamp
+    virtual void dump(double timeStamp, double timeStep, std::size_t step) = 0;
+
+    // loads the local patches of the level from the checkpoint the simulation restarts from
+    virtual void load(int levelNumber) = 0;
+
+    inline virtual ~ICheckpointManager();
+};
+ICheckpointManager::~ICheckpointManager() {}
+
+
+
+/*
+ * CheckpointManager writes checkpoints at the times given in the "restarts" block of the
+ * simulation dict, at the time step closest to each of them, one file per checkpoint in filePath
+ * named after the time of the model written, see restartFilePath. It loads the checkpoint given
+ * by loadPath, which the RestartDataProvider sets when the simulation restarts.
+ * Times at or before the restart time are not written again.
+ */
+template<typename Checkpoint>
+class CheckpointManager : public ICheckpointManager
+{
+public:
+    template<typename Hierarchy, typename Model>
+    CheckpointManager(Hierarchy& hierarchy, Model& model, initializer::PHAREDict& dict)
+        : checkpoint_{hierarchy, model}
+        , filePath_{dict["filePath"].template to<std::string>()}
+    {
+        if (dict.contains("write_timestamps"))
+            timeStamps_ = dict["write_timestamps"].template to<std::vector<double>>();
+        if (dict.contains("loadPath"))
+            loadPath_ = dict["loadPath"].template to<std::string>();
+
+        if (dict.contains("restart_time"))
+        {
+            auto const restartTime = dict["restart_time"].template to<double>();
+            while (next_ < timeStamps_.size() and timeStamps_[next_] <= restartTime)
+                ++next_;
+        }
+    }
+
+    template<typename Hierarchy, typename Model>
+    static std::unique_ptr<CheckpointManager> make_unique(Hierarchy& hierarchy, Model& model,
+                                                          initializer::PHAREDict& dict)
+    {
+        return std::make_unique<CheckpointManager>(hierarchy, model, dict);
+    }
+
+    void dump(double timeStamp, double timeStep, std::size_t step) override
+    {
+        // a scheduled time is due once less than half a step ahead, timeStamp being then the
+        // closest time step whatever the rounding errors of the accumulated time
+        auto isDue = [&](double scheduled) { return timeStamp > scheduled - timeStep / 2; };
+
+        if (next_ < timeStamps_.size() and isDue(timeStamps_[next_]))
+        {
+            checkpoint_.write(initializer::restartFilePath(filePath_, timeStamp), timeStamp, step);
+            while (next_ < timeStamps_.size() and isDue(timeStamps_[next_]))
+                ++next_;
+        }
+    }
+
+    void load(int levelNumber) override
+    {
+        if (loadPath_.empty())
+            throw std::runtime_error("Error: no checkpoint to restart from");
+        checkpoint_.loadLevel(loadPath_, levelNumber);
+    }
+
+private:
+    Checkpoint checkpoint_;
+    std::string filePath_, loadPath_;
+    std::vector<double> timeStamps_;
+    std::size_t next_ = 0;
+};
+
+} // namespace PHARE::diagnostic
+
+#endif /* PHARE_DIAGNOSTIC_CHECKPOINT_MANAGER_H */
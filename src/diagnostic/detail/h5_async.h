@@ -0,0 +1,249 @@
+#ifndef PHARE_DIAGNOSTIC_DETAIL_H5_ASYNC_H
+#define PHARE_DIAGNOSTIC_DETAIL_H5_ASYNC_H
+
+#include "diagnostic/detail/h5_utils.h"
+
+#include "highfive/H5File.hpp"
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <condition_variable>
+
+namespace PHARE::diagnostic::h5
+{
+/*
+ * A DumpSnapshot holds a copy of all the data one dump writes to disk, so that the writes can be
+ * performed while the simulation modifies the original data.
+ * Buffers are kept from one dump to the other and only grow, so that a snapshot recycled for
+ * later dumps does not allocate once it has reached the size of the largest dump.
+ */
+class DumpSnapshot
+{
+public:
+    /* copy size elements of data to be written later in the dataset at path in file h5, from
+     * element offset, or in the whole dataset by default, or in the given row of a time series
+     * the HighFive file handle is copied, which keeps the file open until the write is done
+     */
+    template<typename Type>
+    void stage(HighFive::File& h5, std::string const& path, Type const* const data,
+               std::size_t size, std::size_t offset = wholeDataSet, std::size_t row = noRow)
+    {
+        if (buffers_.size() == nbrWrites_)
+            buffers_.emplace_back();
+
+        auto& buffer = buffers_[nbrWrites_++];
+        buffer.resize(size * sizeof(Type));
+        if (size > 0)
+            std::memcpy(buffer.data(), data, size * sizeof(Type));
+
+        writes_.push_back(PendingWrite{fileIndex_(h5), path, offset, size, row, &write_<Type>});
+    }
+
+
+    // to be called by the I/O thread, with the HDF5 lock held
+    void write()
+    {
+        for (std::size_t i = 0; i < writes_.size(); ++i)
+        {
+            auto& pending = writes_[i];
+            pending.write(files_[pending.file], pending.path, buffers_[i].data(), pending.offset,
+                          pending.size, pending.row);
+        }
+    }
+
+
+    // drops file handles and pending writes, buffers are kept for the next dump
+    // HDF5 handles are closed, so the HDF5 lock must be held
+    void clear()
+    {
+        writes_.clear();
+        files_.clear();
+        nbrWrites_ = 0;
+    }
+
+    bool empty() const { return writes_.empty(); }
+
+private:
+    struct PendingWrite
+    {
+        std::size_t file;
+        std::string path;
+        std::size_t offset, size, row;
+        void (*write)(HighFive::File&, std::string const&, std::byte const*, std::size_t,
+                      std::size_t, std::size_t);
+    };
+
+    template<typename Type>
+    static void write_(HighFive::File& h5, std::string const& path, std::byte const* data,
+                       std::size_t offset, std::size_t size, std::size_t row)
+    {
+        writeDataSetSlice(h5, path, reinterpret_cast<Type const*>(data), offset, size, row);
+    }
+
+    std::size_t fileIndex_(HighFive::File& h5)
+    {
+        for (std::size_t i = 0; i < files_.size(); ++i)
+            if (files_[i].getId() == h5.getId())
+                return i;
+        files_.push_back(h5);
+        return files_.size() - 1;
+    }
+
+    std::vector<HighFive::File> files_;
+    std::vector<PendingWrite> writes_;
+    std::vector<std::vector<std::byte>> buffers_;
+    std::size_t nbrWrites_ = 0;
+};
+
+
+
+
+/*
+ * AsyncDumpQueue performs the writes of staged dumps on a dedicated I/O thread.
+ *
+ * Up to maxInFlight dumps may wait or be written while the simulation advances, plus the one
+ * being staged, maxInFlight = 1 is double buffering. Acquiring a snapshot for staging blocks
+ * while all of them are in flight.
+ *
+ * HDF5 is not assumed to be thread safe: every HDF5 call, on whichever thread, must be made
+ * while holding h5Mutex(), the process wide hdf5Mutex() that checkpoints also take. The snapshot
+ * must be acquired before the mutex is locked, otherwise the I/O thread could not complete the
+ * writes that would free one.
+ */
+class AsyncDumpQueue
+{
+public:
+    AsyncDumpQueue(std::size_t maxInFlight)
+    {
+        if (maxInFlight == 0)
+            throw std::runtime_error("Error: AsyncDumpQueue needs at least one dump in flight");
+
+        for (std::size_t i = 0; i < maxInFlight + 1; ++i)
+            free_.push_back(std::make_unique<DumpSnapshot>());
+
+        thread_ = std::thread{[this]() { run_(); }};
+    }
+
+    ~AsyncDumpQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stop_ = true;
+        }
+        cv_.notify_all();
+        thread_.join();
+    }
+
+
+    DumpSnapshot& acquire()
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        if (!staging_)
+        {
+            cv_.wait(lock, [this]() { return !free_.empty(); });
+            rethrow_();
+            staging_ = std::move(free_.front());
+            free_.pop_front();
+        }
+        return *staging_;
+    }
+
+
+    // hands the snapshot being staged over to the I/O thread
+    void submit()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (!staging_)
+                return;
+            pending_.push_back(std::move(staging_));
+        }
+        cv_.notify_all();
+    }
+
+
+    // blocks until all submitted dumps are on disk
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        cv_.wait(lock, [this]() { return pending_.empty() && !writing_; });
+        rethrow_();
+    }
+
+
+    std::mutex& h5Mutex() { return hdf5Mutex(); }
+
+
+private:
+    void run_()
+    {
+        while (true)
+        {
+            std::unique_ptr<DumpSnapshot> snapshot;
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                cv_.wait(lock, [this]() { return stop_ || !pending_.empty(); });
+                if (pending_.empty()) // stopping with nothing left to write
+                    return;
+                snapshot = std::move(pending_.front());
+                pending_.pop_front();
+                writing_ = true;
+            }
+
+            std::exception_ptr error;
+            {
+                std::lock_guard<std::mutex> h5Lock{hdf5Mutex()};
+                try
+                {
+                    snapshot->write();
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+                snapshot->clear();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (error && !error_)
+                    error_ = error;
+                free_.push_back(std::move(snapshot));
+                writing_ = false;
+            }
+            cv_.notify_all();
+        }
+    }
+
+
+    // errors of the I/O thread are reported to the simulation thread at the next acquire or flush
+    void rethrow_()
+    {
+        if (error_)
+            std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unique_ptr<DumpSnapshot> staging_;
+    std::deque<std::unique_ptr<DumpSnapshot>> pending_;
+    std::deque<std::unique_ptr<DumpSnapshot>> free_;
+    std::exception_ptr error_;
+    bool writing_ = false;
+    bool stop_    = false;
+    std::thread thread_;
+};
+
+} // namespace PHARE::diagnostic::h5
+
+#endif /* PHARE_DIAGNOSTIC_DETAIL_H5_ASYNC_H */
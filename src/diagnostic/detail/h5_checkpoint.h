@@ -0,0 +1,609 @@
+#ifndef PHARE_DIAGNOSTIC_DETAIL_H5_CHECKPOINT_H
+#define PHARE_DIAGNOSTIC_DETAIL_H5_CHECKPOINT_H
+
+#include "diagnostic/detail/h5file.h"
+#include "diagnostic/detail/h5_utils.h"
+#include "diagnostic/detail/h5_level_datasets.h"
+
+#include "core/utilities/box/box.h"
+#include "core/utilities/mpi_utils.h"
+#include "core/data/particles/particle.h"
+#include "core/data/particles/particle_array.h"
+#include "core/data/particles/particle_packer.h"
+#include "core/data/vecfield/vecfield_component.h"
+
+#include <array>
+#include <mutex>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace PHARE::diagnostic::h5
+{
+// true if box1 and box2 intersect, their intersection being then set in intersection
+template<typename T, std::size_t dim>
+bool intersect(core::Box<T, dim> const& box1, core::Box<T, dim> const& box2,
+               core::Box<T, dim>& intersection)
+{
+    for (std::size_t i = 0; i < dim; ++i)
+    {
+        intersection.lower[i] = std::max(box1.lower[i], box2.lower[i]);
+        intersection.upper[i] = std::min(box1.upper[i], box2.upper[i]);
+        if (intersection.lower[i] > intersection.upper[i])
+            return false;
+    }
+    return true;
+}
+
+
+
+/*
+ * BoxLookup finds the boxes of a set intersecting a given box without testing all of them.
+ * Boxes are registered in the bins of a regular grid whose bins are as large as the largest box,
+ * so that each box is in at most 2^dimension bins and a query only visits the bins it covers.
+ */
+template<std::size_t dimension>
+class BoxLookup
+{
+public:
+    using Box = core::Box<int, dimension>;
+
+    explicit BoxLookup(std::vector<Box> const& boxes)
+        : boxes_{boxes}
+    {
+        if (boxes_.empty())
+            return;
+
+        bounds_ = boxes_[0];
+        binSize_.fill(1);
+        for (auto const& box : boxes_)
+            for (std::size_t i = 0; i < dimension; ++i)
+            {
+                bounds_.lower[i] = std::min(bounds_.lower[i], box.lower[i]);
+                bounds_.upper[i] = std::max(bounds_.upper[i], box.upper[i]);
+                binSize_[i]      = std::max(binSize_[i], box.upper[i] - box.lower[i] + 1);
+            }
+
+        std::size_t nbrBins = 1;
+        for (std::size_t i = 0; i < dimension; ++i)
+        {
+            nbrBins_[i] = (bounds_.upper[i] - bounds_.lower[i]) / binSize_[i] + 1;
+            nbrBins *= nbrBins_[i];
+        }
+        bins_.resize(nbrBins);
+
+        for (std::size_t iBox = 0; iBox < boxes_.size(); ++iBox)
+            forEachBin_(boxes_[iBox], [&](std::size_t bin) { bins_[bin].push_back(iBox); });
+    }
+
+    // indexes of the boxes intersecting box, in increasing order
+    std::vector<std::size_t> intersecting(Box const& box) const
+    {
+        std::vector<std::size_t> indexes;
+        Box clipped, overlap;
+        if (bins_.empty() or !intersect(box, bounds_, clipped))
+            return indexes;
+
+        forEachBin_(clipped, [&](std::size_t bin) {
+            for (auto const iBox : bins_[bin])
+                if (intersect(boxes_[iBox], box, overlap))
+                    indexes.push_back(iBox);
+        });
+
+        // a box registered in several bins is found once per bin
+        std::sort(std::begin(indexes), std::end(indexes));
+        indexes.erase(std::unique(std::begin(indexes), std::end(indexes)), std::end(indexes));
+        return indexes;
+    }
+
+private:
+    // calls fn with the flat index of each bin covered by box, which must be within bounds_
+    template<typename Fn>
+    void forEachBin_(Box const& box, Fn&& fn) const
+    {
+        std::array<int, dimension> lower, upper, bin;
+        for (std::size_t i = 0; i < dimension; ++i)
+        {
+            lower[i] = (box.lower[i] - bounds_.lower[i]) / binSize_[i];
+            upper[i] = (box.upper[i] - bounds_.lower[i]) / binSize_[i];
+            bin[i]   = lower[i];
+        }
+
+        while (true)
+        {
+            std::size_t flat = 0;
+            for (std::size_t i = 0; i < dimension; ++i)
+                flat = flat * nbrBins_[i] + bin[i];
+            fn(flat);
+
+            int i = static_cast<int>(dimension) - 1;
+            for (; i >= 0; --i)
+            {
+                if (++bin[i] <= upper[i])
+                    break;
+                bin[i] = lower[i];
+            }
+            if (i < 0)
+                return;
+        }
+    }
+
+    std::vector<Box> boxes_;
+    Box bounds_;
+    std::array<int, dimension> binSize_, nbrBins_;
+    std::vector<std::vector<std::size_t>> bins_;
+};
+
+
+
+/*
+ * Checkpoint writes, in a single file, the state of the hybrid model a simulation needs to
+ * restart, and loads it back level by level, possibly on a different number of MPI ranks.
+ *
+ * The file uses the level dataset layout, see LevelDatasets, with doubles stored exactly:
+ *
+ * /pl#/patches/(lower, upper, origin)      : boxes of the patches of level #
+ * /pl#/(EM_B, EM_E, J)_(x, y, z)           : fields, ghost nodes included
+ * /pl#/ions/pop/<pop>/<array>/(weight, charge, iCell, delta, v)
+ *                                          : particles, <array> being domain, levelGhostOld or
+ *                                            levelGhostNew
+ * /pl#/offsets/<dataset>                   : slice of each patch in <dataset>
+ * attributes of / : time, step, nbrLevels
+ *
+ * Patch ghost particles are copies of the domain particles of neighbour patches, they are not
+ * written and are exchanged again once loaded. The pushable level ghost particles are a copy of
+ * levelGhostOld between two coarse time steps.
+ *
+ * Loading only assumes that each level covers the same cells as when the checkpoint was written,
+ * not that patches are the same. Each rank reads the patch boxes and the offset tables of the
+ * level once, finds the checkpoint patches overlapping each of its own patches with a BoxLookup,
+ * then only reads the slices of these patches:
+ * - field nodes are copied from all overlapping patches, interior nodes having precedence over
+ *   ghost nodes,
+ * - domain particles go to the patch whose box holds their cell,
+ * - level ghost particles go to the patches whose particle ghost box holds their cell, taken from
+ *   the first checkpoint patch whose ghost box holds that cell only, since patches along the
+ *   level border hold copies of the same particles.
+ *
+ * HDF5 calls are made holding hdf5Mutex(), as the I/O thread of asynchronous diagnostics may
+ * write at the same time.
+ */
+template<typename ModelView>
+class Checkpoint
+{
+public:
+    using GridLayout                  = typename ModelView::GridLayout;
+    static constexpr auto dimension   = GridLayout::dimension;
+    static constexpr auto interpOrder = GridLayout::interp_order;
+
+    template<typename Hierarchy, typename Model>
+    Checkpoint(Hierarchy& hierarchy, Model& model)
+        : modelView_{hierarchy, model}
+    {
+    }
+
+    // collectively writes the checkpoint file at path
+    void write(std::string const& path, double time, std::size_t step);
+
+    // loads the data of the local patches of the level from the checkpoint file at path
+    void loadLevel(std::string const& path, int levelNumber);
+
+    static std::string levelPath(std::size_t iLevel) { return "/pl" + std::to_string(iLevel); }
+
+private:
+    using Box      = core::Box<int, dimension>;
+    using Particle = core::Particle<dimension>;
+
+    static constexpr std::array<char const*, 3> particleArrays_{
+        {"domain", "levelGhostOld", "levelGhostNew"}};
+
+    auto fields_()
+    {
+        auto fields = modelView_.getElectromagFields();
+        fields.push_back(&modelView_.getCurrent());
+        return fields;
+    }
+
+    template<typename Population>
+    static auto& particles_(Population& pop, std::string const& array)
+    {
+        if (array == "domain")
+            return pop.domainParticles();
+        if (array == "levelGhostOld")
+            return pop.levelGhostParticlesOld();
+        return pop.levelGhostParticlesNew();
+    }
+
+    template<typename Population>
+    static std::string particlesPath_(Population const& pop, std::string const& array)
+    {
+        return "ions/pop/" + pop.name() + "/" + array + "/";
+    }
+
+    // calls fn(name, data, size) for each dataset of the current patch
+    // particles are only packed in buffer_ if pack is true, data is not to be read otherwise
+    template<typename Fn>
+    void visitPatchData_(bool pack, Fn&& fn);
+
+    // offset and size of each checkpoint patch in the datasets of a level, by dataset name
+    using Offsets = std::unordered_map<std::string, std::vector<std::size_t>>;
+
+    // reads the field from the checkpoint patches given by patchIndexes, which overlap layout
+    template<typename Field>
+    void loadField_(HiFile& h5, std::string const& path, Field& field, GridLayout const& layout,
+                    std::vector<Box> const& patches, std::vector<std::size_t> const& patchIndexes,
+                    std::vector<std::size_t> const& offsets);
+
+    template<typename Particles, typename Keep>
+    void loadParticles_(HiFile& h5, std::string const& path, Particles& particles,
+                        std::vector<std::size_t> const& patchIndexes,
+                        std::vector<std::size_t> const& offsets, Keep&& keep);
+
+    static std::vector<Box> readPatches_(HiFile& h5, std::string const& levelPath);
+
+    // offsets of all the datasets of the level, each offsets table has an entry per patch
+    static Offsets readOffsets_(HiFile& h5, std::string const& levelPath);
+
+    // AMR indexes of the nodes of the field, with or without its ghost nodes, on the cell box
+    template<typename Centering>
+    static Box nodeBox_(Box const& cellBox, Centering const& centering, bool withGhosts);
+
+    // copies the nodes of overlap from source, laid out on sourceNodes, to destination
+    static void copyNodes_(double const* source, Box const& sourceNodes, double* destination,
+                           Box const& destinationNodes, Box const& overlap);
+
+    ModelView modelView_;
+    LevelDatasets<dimension> levelDatasets_{/*keepDoubles=*/true};
+    core::ContiguousParticles<dimension> buffer_{0};
+    std::vector<double> fieldBuffer_;
+
+    static inline std::string const fileKey_ = "checkpoint";
+    static constexpr int maxLevel_           = std::numeric_limits<int>::max();
+};
+
+
+
+template<typename ModelView>
+void Checkpoint<ModelView>::write(std::string const& path, double time, std::size_t step)
+{
+    std::lock_guard<std::mutex> h5Lock{hdf5Mutex()};
+
+    HighFiveFile file{path, HiFile::ReadWrite | HiFile::Create | HiFile::Truncate};
+    auto& h5 = file.file();
+
+    levelDatasets_.clear();
+    std::size_t maxLocalLevel = 0;
+
+    auto countPatch = [&](GridLayout& layout, std::string const&, std::size_t iLevel) {
+        levelDatasets_.addPatch(iLevel, layout.AMRBox().lower.toVector(),
+                                layout.AMRBox().upper.toVector(), layout.origin().toVector());
+        visitPatchData_(false, [&](std::string const& name, auto const* data, std::size_t size) {
+            using Type = std::decay_t<decltype(*data)>;
+            levelDatasets_.template count<Type>(fileKey_, name, size);
+        });
+        maxLocalLevel = std::max(maxLocalLevel, iLevel);
+    };
+    modelView_.visitHierarchy(countPatch, 0, maxLevel_);
+
+    std::size_t const nbrLevels = core::mpi::max(maxLocalLevel) + 1;
+    DatasetOptions const contiguous{};
+    levelDatasets_.create([&](std::string const&) -> HiFile& { return h5; },
+                          [&](std::string const&) -> DatasetOptions const& { return contiguous; },
+                          [](std::size_t iLevel) { return levelPath(iLevel); }, 0, nbrLevels - 1);
+
+    auto writePatch = [&](GridLayout&, std::string const&, std::size_t iLevel) {
+        levelDatasets_.selectPatch(iLevel);
+        visitPatchData_(true, [&](std::string const& name, auto const* data, std::size_t size) {
+            using Type = std::decay_t<decltype(*data)>;
+            if (size > 0)
+                writeDataSetSlice(h5, levelPath(iLevel) + "/" + name, data,
+                                  levelDatasets_.template offset<Type>(fileKey_, name), size);
+        });
+    };
+    modelView_.visitHierarchy(writePatch, 0, maxLevel_);
+
+    h5.createAttribute<double>("time", HighFive::DataSpace::From(time)).write(time);
+    h5.createAttribute<std::size_t>("step", HighFive::DataSpace::From(step)).write(step);
+    h5.createAttribute<std::size_t>("nbrLevels", HighFive::DataSpace::From(nbrLevels))
+        .write(nbrLevels);
+}
+
+
+
+template<typename ModelView>
+void Checkpoint<ModelView>::loadLevel(std::string const& path, int levelNumber)
+{
+    std::lock_guard<std::mutex> h5Lock{hdf5Mutex()};
+
+    HiFile h5{path, HiFile::ReadOnly};
+    auto const lvlPath = levelPath(levelNumber);
+    if (!h5.exist(lvlPath))
+        throw std::runtime_error("Error: checkpoint " + path + " has no level "
+                                 + std::to_string(levelNumber));
+
+    auto const patches = readPatches_(h5, lvlPath);
+    auto const offsets = readOffsets_(h5, lvlPath);
+
+    auto const ghostWidth = static_cast<int>(GridLayout::ghostWidthForParticles());
+    std::vector<Box> ghostBoxes{patches};
+    for (auto& box : ghostBoxes)
+        box.grow(ghostWidth);
+
+    // ghost boxes hold the patches, and field ghost nodes are within the particle ghost boxes
+    BoxLookup<dimension> const lookup{ghostBoxes};
+
+    auto loadPatch = [&](GridLayout& layout, std::string const&, std::size_t) {
+        Box const patchBox = layout.AMRBox();
+        Box patchGhostBox  = patchBox;
+        patchGhostBox.grow(ghostWidth);
+
+        // in increasing order, so that the first holding a cell is the first of all patches
+        auto const ghostPatches = lookup.intersecting(patchGhostBox);
+
+        std::vector<std::size_t> domainPatches;
+        Box overlap;
+        for (auto const iPatch : ghostPatches)
+            if (intersect(patches[iPatch], patchBox, overlap))
+                domainPatches.push_back(iPatch);
+
+        for (auto* vecField : fields_())
+            for (auto& [id, type] : core::Components::componentMap)
+            {
+                auto const name = vecField->name() + "_" + id;
+                loadField_(h5, lvlPath + "/" + name, vecField->getComponent(type), layout,
+                           patches, ghostPatches, offsets.at(name));
+            }
+
+        // index of the first checkpoint patch holding the cell in its particle ghost box
+        auto firstHolder = [&](auto const& cell) {
+            for (auto const iPatch : ghostPatches)
+                if (core::isIn(cell, ghostBoxes[iPatch]))
+                    return iPatch;
+            return patches.size();
+        };
+
+        for (auto& pop : modelView_.getIons())
+        {
+            for (std::string const array : particleArrays_)
+            {
+                auto& particles      = particles_(pop, array);
+                auto const name      = particlesPath_(pop, array);
+                auto const fullPath  = lvlPath + "/" + name;
+                auto const& pOffsets = offsets.at(name + "weight");
+                core::empty(particles);
+
+                if (array == "domain")
+                    loadParticles_(h5, fullPath, particles, domainPatches, pOffsets,
+                                   [&](Particle const& particle, std::size_t) {
+                                       return core::isIn(core::cellAsPoint(particle), patchBox);
+                                   });
+                else
+                    loadParticles_(h5, fullPath, particles, ghostPatches, pOffsets,
+                                   [&](Particle const& particle, std::size_t iPatch) {
+                                       auto const cell = core::cellAsPoint(particle);
+                                       return core::isIn(cell, patchGhostBox)
+                                              and firstHolder(cell) == iPatch;
+                                   });
+            }
+            core::empty(pop.patchGhostParticles());
+            pop.levelGhostParticles().copyData(pop.levelGhostParticlesOld());
+        }
+    };
+
+    modelView_.visitHierarchy(loadPatch, levelNumber, levelNumber);
+}
+
+
+
+template<typename ModelView>
+template<typename Fn>
+void Checkpoint<ModelView>::visitPatchData_(bool pack, Fn&& fn)
+{
+    for (auto* vecField : fields_())
+        for (auto& [id, type] : core::Components::componentMap)
+        {
+            auto& field = vecField->getComponent(type);
+            fn(vecField->name() + "_" + id, field.data(), field.size());
+        }
+
+    for (auto& pop : modelView_.getIons())
+        for (std::string const array : particleArrays_)
+        {
+            auto& particles = particles_(pop, array);
+            auto const size = particles.size();
+            if (pack)
+            {
+                if (buffer_.size() < size)
+                    buffer_ = core::ContiguousParticles<dimension>{size};
+                core::ParticlePacker<dimension>{particles}.pack(buffer_);
+            }
+
+            auto const path = particlesPath_(pop, array);
+            fn(path + "weight", buffer_.weight.data(), size);
+            fn(path + "charge", buffer_.charge.data(), size);
+            fn(path + "iCell", buffer_.iCell.data(), size * dimension);
+            fn(path + "delta", buffer_.delta.data(), size * dimension);
+            fn(path + "v", buffer_.v.data(), size * 3);
+        }
+}
+
+
+
+template<typename ModelView>
+template<typename Field>
+void Checkpoint<ModelView>::loadField_(HiFile& h5, std::string const& path, Field& field,
+                                       GridLayout const& layout, std::vector<Box> const& patches,
+                                       std::vector<std::size_t> const& patchIndexes,
+                                       std::vector<std::size_t> const& offsets)
+{
+    auto const centering  = GridLayout::centering(field.physicalQuantity());
+    auto const patchNodes = nodeBox_(layout.AMRBox(), centering, true);
+    auto dataSet          = h5.getDataSet(path);
+
+    // slices of the overlapping checkpoint patches, read once for both passes
+    std::vector<std::size_t> overlapping, starts;
+    fieldBuffer_.clear();
+    Box overlap;
+    for (auto const iPatch : patchIndexes)
+        if (intersect(nodeBox_(patches[iPatch], centering, true), patchNodes, overlap))
+        {
+            auto const offset = offsets[2 * iPatch], size = offsets[2 * iPatch + 1];
+            overlapping.push_back(iPatch);
+            starts.push_back(fieldBuffer_.size());
+            fieldBuffer_.resize(fieldBuffer_.size() + size);
+            dataSet.select({offset}, {size}).read(fieldBuffer_.data() + starts.back());
+        }
+
+    for (bool const interior : {false, true})
+        for (std::size_t i = 0; i < overlapping.size(); ++i)
+        {
+            auto const& cellBox = patches[overlapping[i]];
+            if (intersect(nodeBox_(cellBox, centering, !interior), patchNodes, overlap))
+                copyNodes_(fieldBuffer_.data() + starts[i], nodeBox_(cellBox, centering, true),
+                           field.data(), patchNodes, overlap);
+        }
+}
+
+
+
+template<typename ModelView>
+template<typename Particles, typename Keep>
+void Checkpoint<ModelView>::loadParticles_(HiFile& h5, std::string const& path,
+                                           Particles& particles,
+                                           std::vector<std::size_t> const& patchIndexes,
+                                           std::vector<std::size_t> const& offsets, Keep&& keep)
+{
+    // offsets are written even if the level has no such particles, datasets are not
+    auto read = [&](std::string const& attribute, auto& buffer, std::size_t offset,
+                    std::size_t size) {
+        if (buffer.size() < size)
+            buffer.resize(size);
+        h5.getDataSet(path + attribute).select({offset}, {size}).read(buffer.data());
+    };
+
+    for (auto const iPatch : patchIndexes)
+    {
+        auto const offset = offsets[2 * iPatch], size = offsets[2 * iPatch + 1];
+        if (size == 0)
+            continue;
+
+        read("weight", buffer_.weight, offset, size);
+        read("charge", buffer_.charge, offset, size);
+        read("iCell", buffer_.iCell, offset * dimension, size * dimension);
+        read("delta", buffer_.delta, offset * dimension, size * dimension);
+        read("v", buffer_.v, offset * 3, size * 3);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            auto particle = buffer_.copy(i);
+            if (keep(particle, iPatch))
+                particles.push_back(particle);
+        }
+    }
+}
+
+
+
+template<typename ModelView>
+auto Checkpoint<ModelView>::readPatches_(HiFile& h5, std::string const& levelPath)
+    -> std::vector<Box>
+{
+    std::vector<int> lower, upper;
+    h5.getDataSet(levelPath + "/patches/lower").read(lower);
+    h5.getDataSet(levelPath + "/patches/upper").read(upper);
+
+    std::vector<Box> patches(lower.size() / dimension);
+    for (std::size_t iPatch = 0; iPatch < patches.size(); ++iPatch)
+        for (std::size_t i = 0; i < dimension; ++i)
+        {
+            patches[iPatch].lower[i] = lower[iPatch * dimension + i];
+            patches[iPatch].upper[i] = upper[iPatch * dimension + i];
+        }
+    return patches;
+}
+
+
+
+template<typename ModelView>
+auto Checkpoint<ModelView>::readOffsets_(HiFile& h5, std::string const& levelPath) -> Offsets
+{
+    Offsets offsets;
+
+    // particle datasets are in subgroups, e.g. ions/pop/<pop>/domain/weight
+    auto readGroup = [&](auto&& self, std::string const& group, std::string const& prefix) -> void {
+        for (auto const& name : h5.getGroup(group).listObjectNames())
+        {
+            auto const objectPath = group + "/" + name;
+            if (h5.getObjectType(objectPath) == HighFive::ObjectType::Group)
+                self(self, objectPath, prefix + name + "/");
+            else
+                h5.getDataSet(objectPath).read(offsets[prefix + name]);
+        }
+    };
+    readGroup(readGroup, levelPath + "/offsets", "");
+    return offsets;
+}
+
+
+
+template<typename ModelView>
+template<typename Centering>
+auto Checkpoint<ModelView>::nodeBox_(Box const& cellBox, Centering const& centering,
+                                     bool withGhosts) -> Box
+{
+    Box nodes = cellBox;
+    for (std::size_t i = 0; i < dimension; ++i)
+    {
+        int const ghosts = withGhosts ? static_cast<int>(GridLayout::nbrGhosts(centering[i])) : 0;
+        int const primal = centering[i] == core::QtyCentering::primal ? 1 : 0;
+        nodes.lower[i] -= ghosts;
+        nodes.upper[i] += primal + ghosts;
+    }
+    return nodes;
+}
+
+
+
+template<typename ModelView>
+void Checkpoint<ModelView>::copyNodes_(double const* source, Box const& sourceNodes,
+                                       double* destination, Box const& destinationNodes,
+                                       Box const& overlap)
+{
+    // nodes are stored row major, the last direction being contiguous
+    auto flatIndex = [](Box const& nodes, std::array<int, dimension> const& node) {
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < dimension; ++i)
+            index = index * (nodes.upper[i] - nodes.lower[i] + 1) + (node[i] - nodes.lower[i]);
+        return index;
+    };
+
+    std::array<int, dimension> node;
+    for (std::size_t i = 0; i < dimension; ++i)
+        node[i] = overlap.lower[i];
+    auto const rowSize = overlap.upper[dimension - 1] - overlap.lower[dimension - 1] + 1;
+
+    while (true)
+    {
+        std::copy_n(source + flatIndex(sourceNodes, node), rowSize,
+                    destination + flatIndex(destinationNodes, node));
+
+        int i = static_cast<int>(dimension) - 2;
+        for (; i >= 0; --i)
+        {
+            if (++node[i] <= overlap.upper[i])
+                break;
+            node[i] = overlap.lower[i];
+        }
+        if (i < 0)
+            return;
+    }
+}
+
+} // namespace PHARE::diagnostic::h5
+
+#endif /* PHARE_DIAGNOSTIC_DETAIL_H5_CHECKPOINT_H */
@@ -0,0 +1,284 @@
+#ifndef PHARE_DIAGNOSTIC_DETAIL_H5_LEVEL_DATASETS_H
+#define PHARE_DIAGNOSTIC_DETAIL_H5_LEVEL_DATASETS_H
+
+#include "highfive/H5DataSet.hpp"
+#include "highfive/H5DataSpace.hpp"
+#include "highfive/H5Easy.hpp"
+
+#include "core/utilities/mpi_utils.h"
+#include "diagnostic/detail/h5_utils.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace PHARE::diagnostic::h5
+{
+/*
+ * LevelDatasets does the bookkeeping of the "level" dataset layout, where each quantity of a
+ * level is a single dataset per dump, each patch writing its data in a contiguous slice:
+ *
+ * /t#/pl#/<dataset>          : data of all the patches of the level, one after the other
+ * /t#/pl#/patches/lower      : lower AMR index of each patch (nbrPatches x dimension)
+ * /t#/pl#/patches/upper      : upper AMR index of each patch (nbrPatches x dimension)
+ * /t#/pl#/patches/origin     : origin of each patch (nbrPatches x dimension)
+ * /t#/pl#/offsets/<dataset>  : offset and size of each patch in <dataset> (nbrPatches x 2)
+ *
+ * Patches are ordered by MPI rank, then in the order each rank visits them.
+ *
+ * A dump visits the hierarchy twice. The first visit only counts what each patch writes.
+ * All ranks then create the same datasets, exchanging only the list of distinct datasets and
+ * one size per dataset and per rank, instead of the path and size of every patch dataset.
+ * The second visit writes each patch in its slice, without further communication.
+ *
+ * Floating point datasets are stored as floats, unless keepDoubles is set, for data that must be
+ * read back exactly, like checkpoints.
+ */
+template<std::size_t dimension>
+class LevelDatasets
+{
+public:
+    explicit LevelDatasets(bool keepDoubles = false)
+        : keepDoubles_{keepDoubles}
+    {
+    }
+
+    // first visit, a patch starts
+    void addPatch(std::size_t level, std::vector<int> const& lower, std::vector<int> const& upper,
+                  std::vector<double> const& origin)
+    {
+        auto& patches = levels_[level];
+        patches.lower.insert(patches.lower.end(), lower.begin(), lower.end());
+        patches.upper.insert(patches.upper.end(), upper.begin(), upper.end());
+        patches.origin.insert(patches.origin.end(), origin.begin(), origin.end());
+        current_ = {level, patches.nbrPatches++};
+    }
+
+    // first visit, the current patch will write size elements in the given dataset
+    template<typename Type>
+    void count(std::string const& file, std::string const& name, std::size_t size)
+    {
+        auto& sizes = datasets_[key_(file, current_.level, name, typeTag_<Type>())].sizes;
+        sizes.resize(levels_[current_.level].nbrPatches, 0);
+        sizes[current_.patch] = size;
+    }
+
+    // second visit, patches must be selected in the same order as in the first visit
+    void selectPatch(std::size_t level) { current_ = {level, levels_[level].nbrSelected++}; }
+
+    // second visit, returns the offset from which the current patch writes the dataset
+    template<typename Type>
+    std::size_t offset(std::string const& file, std::string const& name) const
+    {
+        auto const& dataset = datasets_.at(key_(file, current_.level, name, typeTag_<Type>()));
+        return dataset.offsets[current_.patch];
+    }
+
+
+    /*
+     * collectively creates the datasets counted by any rank for levels minLevel to maxLevel,
+     * and writes the patch index tables. getFile returns the HighFive file for a file name,
+     * getOptions the DatasetOptions of its datasets and levelPath the group of a level for the
+     * current dump. Index tables are small and always stored contiguously.
+     */
+    template<typename GetFile, typename GetOptions, typename LevelPath>
+    void create(GetFile&& getFile, GetOptions&& getOptions, LevelPath&& levelPath,
+                std::size_t minLevel, std::size_t maxLevel)
+    {
+        std::vector<std::string> keys = collectKeys_();
+
+        std::vector<std::size_t> local;
+        for (auto const& key : keys)
+        {
+            std::size_t size = 0;
+            if (datasets_.count(key))
+                for (auto const& patchSize : datasets_[key].sizes)
+                    size += patchSize;
+            local.push_back(size);
+        }
+        for (std::size_t lvl = minLevel; lvl <= maxLevel; ++lvl)
+            local.push_back(levels_[lvl].nbrPatches);
+
+        int const mpi_size = core::mpi::size();
+        int const rank     = core::mpi::rank();
+        auto perRank       = core::mpi::collect(local, mpi_size);
+
+        // total over all ranks of entry i, and sum over lower ranks
+        auto totalAndOffset = [&](std::size_t i) {
+            std::size_t total = 0, offset = 0;
+            for (int r = 0; r < mpi_size; ++r)
+            {
+                if (r == rank)
+                    offset = total;
+                total += perRank[r][i];
+            }
+            return std::make_pair(total, offset);
+        };
+
+        std::map<std::size_t, std::pair<std::size_t, std::size_t>> levelPatches;
+        for (std::size_t lvl = minLevel; lvl <= maxLevel; ++lvl)
+            levelPatches[lvl] = totalAndOffset(keys.size() + lvl - minLevel);
+
+        std::set<std::pair<std::string, std::size_t>> indexedLevels;
+
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            auto [file, level, name, tag] = parseKey_(keys[i]);
+            auto [size, offset]           = totalAndOffset(i);
+            auto [nbrPatches, firstPatch] = levelPatches.at(level);
+            auto& h5                      = getFile(file);
+            auto const path               = levelPath(level);
+
+            if (size > 0)
+            {
+                auto const& options = getOptions(file);
+                if (tag == 'd')
+                    createDataSet<double>(h5, path + "/" + name, size, options);
+                else if (tag == 'f') // doubles are stored as floats
+                    createDataSet<float>(h5, path + "/" + name, size, options);
+                else
+                    createDataSet<int>(h5, path + "/" + name, size, options);
+            }
+
+            auto& dataset = datasets_[keys[i]];
+            dataset.sizes.resize(levels_[level].nbrPatches, 0);
+            dataset.offsets.resize(dataset.sizes.size());
+
+            std::vector<std::size_t> index;
+            for (std::size_t iPatch = 0; iPatch < dataset.sizes.size(); ++iPatch)
+            {
+                dataset.offsets[iPatch] = offset;
+                index.push_back(offset);
+                index.push_back(dataset.sizes[iPatch]);
+                offset += dataset.sizes[iPatch];
+            }
+            writeIndex_(h5, path + "/offsets/" + name, index, 2 * firstPatch, 2 * nbrPatches);
+
+            if (!indexedLevels.count({file, level}))
+            {
+                indexedLevels.emplace(file, level);
+                auto& patches = levels_[level];
+                auto first    = dimension * firstPatch;
+                auto size     = dimension * nbrPatches;
+                writeIndex_(h5, path + "/patches/lower", patches.lower, first, size);
+                writeIndex_(h5, path + "/patches/upper", patches.upper, first, size);
+                writeIndex_(h5, path + "/patches/origin", patches.origin, first, size);
+            }
+        }
+    }
+
+
+    void clear()
+    {
+        levels_.clear();
+        datasets_.clear();
+        current_ = {};
+    }
+
+
+private:
+    struct LevelPatches
+    {
+        std::size_t nbrPatches  = 0;
+        std::size_t nbrSelected = 0;
+        std::vector<int> lower, upper;
+        std::vector<double> origin;
+    };
+
+    struct Dataset
+    {
+        std::vector<std::size_t> sizes;   // per local patch of the level
+        std::vector<std::size_t> offsets; // per local patch of the level
+    };
+
+    struct Key
+    {
+        std::string file;
+        std::size_t level;
+        std::string name;
+        char tag;
+    };
+
+    struct Current
+    {
+        std::size_t level = 0, patch = 0;
+    };
+
+
+    template<typename Type>
+    char typeTag_() const
+    {
+        if constexpr (std::is_same_v<Type, double>)
+            return keepDoubles_ ? 'd' : 'f';
+        else if constexpr (std::is_same_v<Type, float>)
+            return 'f';
+        else if constexpr (std::is_same_v<Type, int>)
+            return 'i';
+        else
+            throw std::runtime_error("Unhandled level dataset type");
+    }
+
+    static std::string key_(std::string const& file, std::size_t level, std::string const& name,
+                            char tag)
+    {
+        return file + '\t' + std::to_string(level) + '\t' + name + '\t' + tag;
+    }
+
+    static Key parseKey_(std::string const& key)
+    {
+        std::stringstream ss{key};
+        std::string file, level, name, tag;
+        std::getline(ss, file, '\t');
+        std::getline(ss, level, '\t');
+        std::getline(ss, name, '\t');
+        std::getline(ss, tag, '\t');
+        return {file, std::stoul(level), name, tag[0]};
+    }
+
+
+    // union over all ranks of the datasets counted, in the same order on all ranks
+    std::vector<std::string> collectKeys_() const
+    {
+        std::string local;
+        for (auto const& [key, _] : datasets_)
+            local += key + '\n';
+
+        std::set<std::string> keys;
+        for (auto const& rankKeys : core::mpi::collect(local))
+        {
+            std::stringstream ss{std::string{rankKeys.begin(), rankKeys.end()}};
+            std::string key;
+            while (std::getline(ss, key, '\n'))
+                keys.insert(key);
+        }
+        return {keys.begin(), keys.end()};
+    }
+
+
+    // creates the index dataset of size elements and writes local values from element first
+    template<typename Type>
+    static void writeIndex_(HighFive::File& h5, std::string const& path,
+                            std::vector<Type> const& local, std::size_t first, std::size_t size)
+    {
+        if (size == 0)
+            return;
+        createDataSet<Type>(h5, path, size);
+        if (local.size() > 0)
+            h5.getDataSet(path).select({first}, {local.size()}).write(local.data());
+    }
+
+
+    std::map<std::size_t, LevelPatches> levels_;
+    std::map<std::string, Dataset> datasets_;
+    Current current_;
+    bool keepDoubles_ = false;
+};
+
+} // namespace PHARE::diagnostic::h5
+
+#endif /* PHARE_DIAGNOSTIC_DETAIL_H5_LEVEL_DATASETS_H */
@@ -2,6 +2,23 @@
 #define H5_UTILS_H
 
 #include "core/utilities/types.h"
+#include "core/utilities/mpi_utils.h"
+#include "diagnostic/diagnostic_props.h"
+
+#include "highfive/H5File.hpp"
+#include "highfive/H5DataSet.hpp"
+#include "highfive/H5DataSpace.hpp"
+#include "highfive/H5Easy.hpp"
+
+#include <mutex>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
 
 namespace PHARE::diagnostic::h5
 {
@@ -9,6 +26,189 @@ template<typename T, std::size_t dimension>
 inline constexpr auto is_array_dataset
     = (core::is_std_array_v<T, dimension> || core::is_std_array_v<T, 3>);
 
+
+/*
+ * HDF5 is not assumed to be thread safe: while the I/O thread of asynchronous diagnostics may
+ * run, see AsyncDumpQueue, every HDF5 call of the process, diagnostics and checkpoints alike, is
+ * made holding this mutex
+ */
+inline std::mutex& hdf5Mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+
+// offset value meaning that the whole dataset is written
+inline constexpr std::size_t wholeDataSet = std::numeric_limits<std::size_t>::max();
+
+// row value meaning that the dataset is not a time series
+inline constexpr std::size_t noRow = std::numeric_limits<std::size_t>::max();
+
+/*
+ * writes size elements of data in the dataset at path, starting at element offset, or the whole
+ * dataset if offset is wholeDataSet
+ * time series datasets, see createTimeSeriesDataSet, are written in the given row
+ */
+template<typename Type>
+void writeDataSetSlice(HighFive::File& h5, std::string const& path, Type const* const data,
+                       std::size_t offset, std::size_t size, std::size_t row = noRow)
+{
+    auto dataSet = h5.getDataSet(path);
+    if (row != noRow)
+        dataSet.select({row, 0}, {1, size}).write(data);
+    else if (offset == wholeDataSet)
+        dataSet.write(data);
+    else
+        dataSet.select({offset}, {size}).write(data);
+}
+
+
+
+// chunk size, in number of elements, of filtered datasets without an explicit chunk size
+inline constexpr std::size_t defaultChunkSize = 1 << 16;
+
+/*
+ * with parallel HDF5, filters are only applied by collective writes, datasets being written
+ * independently by each rank cannot be compressed. The options are checked when diagnostics
+ * are added, all ranks reading the same input they all throw
+ */
+inline void checkDatasetOptions(DatasetOptions const& options)
+{
+    if (options.mantissaBits > 0 and options.quantizedDatasets.empty())
+        throw std::runtime_error("Error: diagnostics 'mantissa_bits' needs 'quantized_datasets', "
+                                 "the datasets it applies to");
+
+#if defined(H5_HAVE_PARALLEL)
+    if (options.gzipLevel > 0 or options.shuffle)
+        throw std::runtime_error("Error: diagnostics 'gzip' and 'shuffle' need serial HDF5, "
+                                 "this build uses parallel HDF5");
+#endif
+}
+
+
+// creation properties of a dataset of size elements stored with the given options
+inline HighFive::DataSetCreateProps dataSetCreateProps(DatasetOptions const& options,
+                                                       std::size_t size, bool timeSeries = false)
+{
+    bool const filtered = options.gzipLevel > 0 or options.shuffle;
+
+    HighFive::DataSetCreateProps props;
+    auto chunkSize = options.chunkSize > 0 ? options.chunkSize : (filtered ? defaultChunkSize : 0);
+    if (timeSeries) // extendible datasets must be chunked, a chunk holds a part of one row
+        props.add(HighFive::Chunking(
+            std::vector<hsize_t>{1, std::min(chunkSize > 0 ? chunkSize : size, size)}));
+    else if (chunkSize == 0 or size == 0)
+        return props;
+    else
+        props.add(HighFive::Chunking(std::vector<hsize_t>{std::min(chunkSize, size)}));
+    if (filtered and options.shuffle)
+        props.add(HighFive::Shuffle());
+    if (filtered and options.gzipLevel > 0)
+        props.add(HighFive::Deflate(static_cast<unsigned>(options.gzipLevel)));
+    return props;
+}
+
+
+template<typename Type>
+void createDataSet(HighFive::File& h5, std::string const& path, std::size_t size,
+                   DatasetOptions const& options = {})
+{
+    H5Easy::detail::createGroupsToDataSet(h5, path);
+    h5.createDataSet<Type>(path, HighFive::DataSpace(size), dataSetCreateProps(options, size));
+}
+
+
+/*
+ * creates a time series dataset, of rows x size elements, where each row holds the data of one
+ * dump. It can be extended by rows, see growTimeSeriesDataSet
+ */
+template<typename Type>
+void createTimeSeriesDataSet(HighFive::File& h5, std::string const& path, std::size_t rows,
+                             std::size_t size, DatasetOptions const& options = {})
+{
+    H5Easy::detail::createGroupsToDataSet(h5, path);
+    HighFive::DataSpace space{{rows, size}, {HighFive::DataSpace::UNLIMITED, size}};
+    h5.createDataSet<Type>(path, space, dataSetCreateProps(options, size, /*timeSeries=*/true));
+}
+
+
+/*
+ * makes room for the given row in a time series dataset, rows are doubled so that appending
+ * dumps only extends datasets a logarithmic number of times. Collective with parallel HDF5
+ */
+inline void growTimeSeriesDataSet(HighFive::File& h5, std::string const& path, std::size_t row)
+{
+    auto dataSet = h5.getDataSet(path);
+    auto dims    = dataSet.getDimensions();
+    if (row >= dims[0])
+        dataSet.resize({std::max(row + 1, 2 * dims[0]), dims[1]});
+}
+
+
+/*
+ * appends time to the 1D extendible dataset at path, created if needed, and returns its index,
+ * which is the row time series datasets of the file are written in for this dump.
+ * Collective with parallel HDF5, only the first rank writes the value
+ */
+inline std::size_t appendTimeStamp(HighFive::File& h5, std::string const& path, double time)
+{
+    if (!h5.exist(path))
+    {
+        HighFive::DataSetCreateProps props;
+        props.add(HighFive::Chunking(std::vector<hsize_t>{64}));
+        HighFive::DataSpace space{{0}, {HighFive::DataSpace::UNLIMITED}};
+        h5.createDataSet<double>(path, space, props);
+    }
+    auto dataSet    = h5.getDataSet(path);
+    auto const rows = dataSet.getDimensions()[0];
+    dataSet.resize({rows + 1});
+    if (core::mpi::rank() == 0)
+        dataSet.select({rows}, {1}).write(&time);
+    return rows;
+}
+
+
+
+/*
+ * rounds value to the nearest float with only mantissaBits bits in its mantissa, the other bits
+ * are zeroed, so that the values compress well. Infinities and NaNs are left unchanged
+ */
+inline float quantizeMantissa(float value, std::size_t mantissaBits)
+{
+    constexpr std::size_t floatMantissaBits = 23;
+    constexpr std::uint32_t exponentMask    = 0x7f800000;
+    if (mantissaBits == 0 or mantissaBits >= floatMantissaBits)
+        return value;
+
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if ((bits & exponentMask) == exponentMask)
+        return value;
+
+    auto const dropped  = floatMantissaBits - mantissaBits;
+    auto const half     = std::uint32_t{1} << (dropped - 1);
+    auto const keptMask = ~((std::uint32_t{1} << dropped) - 1);
+    bits                = (bits + half) & keptMask; // rounds half up on the kept bits
+    std::memcpy(&value, &bits, sizeof(bits));
+    return value;
+}
+
+
+// mantissa bits kept for the dataset name, 0 if it is stored without loss, as are datasets not
+// listed. Vector field components, e.g. "EM_B_x", are quantized when their field, "EM_B", is listed
+inline std::size_t quantizedMantissaBits(DatasetOptions const& options, std::string const& name)
+{
+    auto const& datasets = options.quantizedDatasets;
+    if (options.mantissaBits == 0)
+        return 0;
+
+    auto listed = [&](std::string const& dataset) {
+        return name == dataset or name.rfind(dataset + "_", 0) == 0;
+    };
+    return std::any_of(datasets.begin(), datasets.end(), listed) ? options.mantissaBits : 0;
+}
+
 } // namespace PHARE::diagnostic::h5
 
 #endif // H5_UTILS_H
@@ -49,7 +49,7 @@ protected:
     void initDataSets_(std::unordered_map<std::size_t, std::vector<std::string>> const& patchIDs,
                        Attributes& patchAttributes, std::size_t maxLevel, InitPatch&& initPatch)
     {
-        for (std::size_t lvl = hi5_.minLevel; lvl <= maxLevel; lvl++)
+        for (std::size_t lvl = hi5_.dumpMinLevel(); lvl <= maxLevel; lvl++)
         {
             auto& lvlPatches       = patchIDs.at(lvl);
             std::size_t patchNbr   = lvlPatches.size();
@@ -68,7 +68,7 @@ protected:
             patchAttributes,
         std::size_t maxLevel)
     {
-        for (std::size_t lvl = hi5_.minLevel; lvl <= maxLevel; lvl++)
+        for (std::size_t lvl = hi5_.dumpMinLevel(); lvl <= maxLevel; lvl++)
         {
             auto& lvlPatches       = patchAttributes.at(lvl);
             std::size_t patchNbr   = lvlPatches.size();
@@ -79,7 +79,8 @@ protected:
                 hi5_.writeAttributeDict(file, hi5_.modelView().getEmptyPatchProperties(), "");
         }
 
-        hi5_.writeAttributeDict(file, fileAttributes, "/");
+        if (hi5_.needsFileAttributes(file))
+            hi5_.writeAttributeDict(file, fileAttributes, "/");
     }
 
     void writeGhostsAttr_(HighFive::File& file, std::string path, std::size_t ghosts, bool null)
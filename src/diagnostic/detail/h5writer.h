@@ -8,22 +8,45 @@
 
 #include "h5typewriter.h"
 #include "h5file.h"
+#include "h5_async.h"
+#include "h5_level_datasets.h"
 
 #include "diagnostic/diagnostic_manager.h"
 #include "diagnostic/diagnostic_props.h"
 
 #include "core/data/vecfield/vecfield_component.h"
+#include "core/logger.h"
 #include "core/utilities/mpi_utils.h"
 
+#include <set>
+#include <map>
+#include <sstream>
+#include <optional>
+#include <unordered_set>
+#include <iostream>
+
 
 namespace PHARE::diagnostic::h5
 {
+/*
+ * how datasets are laid out in diagnostic files
+ *  PATCH       : one dataset per patch and quantity, in one group per dump, /t#/pl#/p#/<dataset>
+ *  LEVEL       : one dataset per level and quantity per dump, see LevelDatasets
+ *  TIME_SERIES : fields are appended to one dataset per patch and quantity, /pl#/p#/<dataset>,
+ *                each row holding a dump, /timestamps giving the time of each row.
+ *                The hierarchy must not change between dumps. Other diagnostics use PATCH.
+ */
+enum class DatasetLayout { PATCH, LEVEL, TIME_SERIES };
+
+
 template<typename HighFiveDiagnostic>
 class ElectromagDiagnosticWriter;
 template<typename HighFiveDiagnostic>
 class FluidDiagnosticWriter;
 template<typename HighFiveDiagnostic>
 class ParticlesDiagnosticWriter;
+template<typename HighFiveDiagnostic>
+class ReducedDiagnosticWriter;
 
 
 
@@ -39,16 +62,45 @@ public:
     static constexpr auto interpOrder = GridLayout::interp_order;
     static constexpr auto READ_WRITE  = HiFile::ReadWrite | HiFile::Create;
 
+    /* maxInFlightDumps > 0 writes datasets on a dedicated I/O thread, while the simulation
+     * advances, with at most maxInFlightDumps dumps waiting to be written
+     * layout selects how datasets are stored, see DatasetLayout
+     */
     template<typename Hierarchy, typename Model>
     Writer(Hierarchy& hier, Model& model, std::string const hifivePath,
-           unsigned _flags /* = HiFile::ReadWrite | HiFile::Create | HiFile::Truncate */)
+           unsigned _flags /* = HiFile::ReadWrite | HiFile::Create | HiFile::Truncate */,
+           std::size_t maxInFlightDumps = 0, DatasetLayout layout = DatasetLayout::PATCH)
         : flags{_flags}
         , filePath_{hifivePath}
         , modelView_{hier, model}
+        , perLevelDatasets_{layout == DatasetLayout::LEVEL}
+        , timeSeries_{layout == DatasetLayout::TIME_SERIES}
     {
+        if (maxInFlightDumps > 0 and asyncWritesSupported_())
+            async_ = std::make_unique<AsyncDumpQueue>(maxInFlightDumps);
+    }
+
+    // joins the I/O thread once all dumps are written. The simulation flushes at the end of the
+    // run, an error still pending here cannot be thrown and goes to the run log instead
+    ~Writer()
+    {
+        try
+        {
+            flush();
+        }
+        catch (std::exception const& e)
+        {
+            core::RunLog::INSTANCE().error(
+                core::LogEntry{"diagnostics_write_error"}("what", e.what()));
+        }
+        async_.reset();
     }
 
-    ~Writer() {}
+    // throws if this build cannot write datasets with the given options
+    static void checkDatasetOptions(DatasetOptions const& options)
+    {
+        h5::checkDatasetOptions(options);
+    }
 
     template<typename Hierarchy, typename Model>
     static decltype(auto) make_unique(Hierarchy& hier, Model& model, initializer::PHAREDict& dict)
@@ -57,7 +109,19 @@ public:
         unsigned flags       = READ_WRITE;
         if (dict.contains("mode") and dict["mode"].template to<std::string>() == "overwrite")
             flags |= HiFile::Truncate;
-        return std::make_unique<This>(hier, model, filePath, flags);
+        std::size_t maxInFlightDumps = 0;
+        if (dict.contains("max_in_flight_dumps"))
+            maxInFlightDumps = dict["max_in_flight_dumps"].template to<int>();
+        auto layout = DatasetLayout::PATCH;
+        if (dict.contains("dataset_layout"))
+        {
+            auto const name = dict["dataset_layout"].template to<std::string>();
+            if (name == "level")
+                layout = DatasetLayout::LEVEL;
+            else if (name == "time_series")
+                layout = DatasetLayout::TIME_SERIES;
+        }
+        return std::make_unique<This>(hier, model, filePath, flags, maxInFlightDumps, layout);
     }
 
 
@@ -65,6 +129,14 @@ public:
     void dump_level(std::size_t level, std::vector<DiagnosticProperties*> const& diagnostics,
                     double timestamp) override;
 
+    // blocks until all dumps are written, rethrowing the errors of the I/O thread, no-op in
+    // synchronous mode
+    void flush()
+    {
+        if (async_)
+            async_->flush();
+    }
+
     template<typename String>
     auto getDiagnosticWriterForType(String& type)
     {
@@ -81,32 +153,97 @@ public:
 
     auto makeFile(std::string const filename)
     {
-        return std::make_unique<HighFiveFile>(filePath_ + "/" + filename, flags);
+        auto file = std::make_unique<HighFiveFile>(filePath_ + "/" + filename, flags);
+        openFiles_[filename] = &file->file();
+        return file;
     }
     auto makeFile(DiagnosticProperties const& diagnostic)
     {
-        return makeFile(fileString(diagnostic.quantity));
+        auto filename             = fileString(diagnostic.quantity);
+        fileOptions_[filename]    = &diagnostic.datasetOptions;
+        fileTimestamps_[filename] = diagnostic.writeTimestamps.size();
+        return makeFile(filename);
     }
 
 
     static std::string getFullPatchPath(std::string timestamp, int iLevel, std::string globalCoords)
     {
-        return "/t" + timestamp + "/pl" + std::to_string(iLevel) + "/p" + globalCoords;
+        return getFullLevelPath(timestamp, iLevel) + "/p" + globalCoords;
+    }
+
+    static std::string getFullLevelPath(std::string timestamp, int iLevel)
+    {
+        return "/t" + timestamp + "/pl" + std::to_string(iLevel);
     }
 
+    /* datasets are stored with the DatasetOptions of the diagnostic the file was made for
+     * time series datasets get a row per scheduled dump of their diagnostic, more are added
+     * if needed
+     */
     template<typename Type>
-    static void createDataSet(HiFile& h5, std::string const& path, std::size_t size)
+    void createDataSet(HiFile& h5, std::string const& path, std::size_t size)
     {
+        auto const& options = datasetOptions_(h5);
+        auto const rows
+            = timeSeriesDump_ ? std::max(fileTimestamps_.at(fileName_(h5)), std::size_t{1}) : 0;
         if constexpr (std::is_same_v<Type, double>) // force doubles for floats for storage
-            This::createDatasetsPerMPI<float>(h5, path, size);
+            This::createDatasetsPerMPI<float>(h5, path, size, options, rows);
         else
-            This::createDatasetsPerMPI<Type>(h5, path, size);
+            This::createDatasetsPerMPI<Type>(h5, path, size, options, rows);
     }
 
+    // in asynchronous mode the array is copied and written later by the I/O thread
     template<typename Array, typename String>
-    static void writeDataSet(HiFile& h5, String path, Array const* const array)
+    void writeDataSet(HiFile& h5, String path, Array const* const array, std::size_t size)
+    {
+        if (timeSeriesDump_)
+        {
+            if (size == 0) // such datasets are not created
+                return;
+            if (checkingTimeSeries_)
+                seriesDatasets_.push_back({fileName_(h5), std::string{path}, size});
+            else
+                write_(h5, path, array, size, wholeDataSet, seriesRows_.at(fileName_(h5)));
+            return;
+        }
+
+        if (!perLevelDatasets_)
+            return write_(h5, path, array, size, wholeDataSet);
+
+        // the patch writes its slice of the level dataset named after its patch dataset
+        auto name = std::string{path}.substr(patchPath_.size() + 1);
+        if (countingLevelDatasets_)
+            countLevelDataSet<Array>(h5, name, size);
+        else if (size > 0)
+            writeLevelDataSet(h5, patchLevel_, name, array, size,
+                              levelDataSetOffset<Array>(h5, name));
+    }
+
+
+    /* level dataset layout, to write several patches at once, datasets are named after the
+     * patch datasets, e.g. "density" for /t#/pl#/p#/density
+     */
+
+    // first visit: the current patch will write size elements of the given dataset
+    template<typename Type>
+    void countLevelDataSet(HiFile& h5, std::string const& name, std::size_t size)
+    {
+        levelDatasets_.template count<Type>(fileName_(h5), name, size);
+    }
+
+    // second visit: offset of the current patch in the given level dataset
+    template<typename Type>
+    std::size_t levelDataSetOffset(HiFile& h5, std::string const& name) const
+    {
+        return levelDatasets_.template offset<Type>(fileName_(h5), name);
+    }
+
+    template<typename Type>
+    void writeLevelDataSet(HiFile& h5, std::size_t iLevel, std::string const& name,
+                           Type const* const data, std::size_t size, std::size_t offset)
     {
-        h5.getDataSet(path).write(array);
+        write_(h5, getFullLevelPath(std::to_string(timestamp_), iLevel) + "/" + name, data, size,
+               offset);
     }
 
     // global function when all path+key are the same
@@ -132,14 +269,20 @@ public:
                                       Data const& value);
 
     template<typename VecField>
-    static void writeVecFieldAsDataset(HiFile& h5, std::string path, VecField& vecField)
+    void writeVecFieldAsDataset(HiFile& h5, std::string path, VecField& vecField)
     {
         for (auto& [id, type] : core::Components::componentMap)
-            h5.getDataSet(path + "_" + id).write(vecField.getComponent(type).data());
+        {
+            auto& component = vecField.getComponent(type);
+            writeDataSet(h5, path + "_" + id, component.data(), component.size());
+        }
     }
 
     auto& modelView() { return modelView_; }
 
+    // first level of the current dump
+    std::size_t dumpMinLevel() const { return dumpMinLevel_; }
+
     std::size_t minLevel = 0, maxLevel = 10; // TODO hard-coded to be parametrized somehow
     unsigned flags;
 
@@ -150,11 +293,39 @@ private:
     std::string patchPath_; // is passed around as "virtual write()" has no parameters
     ModelView modelView_;
     Attributes fileAttributes_;
+    std::unique_ptr<AsyncDumpQueue> async_;
+
+    // levels of the current dump, all of them, or a single one for fine level dumps
+    std::size_t dumpMinLevel_ = 0, dumpMaxLevel_ = 0;
+    std::optional<std::size_t> finestLevel_; // with patches on any rank, in the current dump
+    std::unordered_set<std::string> attributedFiles_; // with their file attributes written
+
+    bool perLevelDatasets_      = false;
+    bool countingLevelDatasets_ = false; // first visit of a level datasets dump
+    bool timeSeries_            = false;
+    bool timeSeriesDump_        = false; // time series diagnostics are being written
+    bool checkingTimeSeries_    = false; // first visit of a time series dump
+    std::size_t patchLevel_     = 0;
+    GridLayout* patchLayout_    = nullptr; // of the patch being visited
+    LevelDatasets<dimension> levelDatasets_;
+    std::unordered_map<std::string, HiFile*> openFiles_; // files of the current dump, by name
+    std::unordered_map<std::string, DatasetOptions const*> fileOptions_; // by file name
+    std::unordered_map<std::string, std::size_t> fileTimestamps_; // scheduled dumps, by file name
+    std::vector<float> quantized_; // lossy copy of the dataset being written
+
+    struct SeriesDataset
+    {
+        std::string file, path;
+        std::size_t size;
+    };
+    std::map<std::string, std::size_t> seriesRows_; // row of the current dump, by file name
+    std::vector<SeriesDataset> seriesDatasets_;     // written by this rank in the current dump
 
     std::unordered_map<std::string, std::shared_ptr<H5TypeWriter<This>>> writers{
         {"fluid", make_writer<FluidDiagnosticWriter<This>>()},
         {"electromag", make_writer<ElectromagDiagnosticWriter<This>>()},
-        {"particle", make_writer<ParticlesDiagnosticWriter<This>>()}};
+        {"particle", make_writer<ParticlesDiagnosticWriter<This>>()},
+        {"reduced", make_writer<ReducedDiagnosticWriter<This>>()}};
 
     template<typename Writer>
     std::shared_ptr<H5TypeWriter<This>> make_writer()
@@ -163,11 +334,89 @@ private:
     }
 
     template<typename Type>
-    static void createDatasetsPerMPI(HiFile& h5, std::string path, std::size_t dataSetSize);
+    static void createDatasetsPerMPI(HiFile& h5, std::string path, std::size_t dataSetSize,
+                                     DatasetOptions const& options = {}, std::size_t rows = 0);
+
+
+    static bool asyncWritesSupported_();
 
+    void dumpLevels_(std::vector<DiagnosticProperties*> const& diagnostics, double timestamp,
+                     std::size_t fromLevel, std::size_t toLevel);
+    void dump_(std::vector<DiagnosticProperties*> const& diagnostics);
+    void dumpLevelDatasets_(std::vector<DiagnosticProperties*> const& diagnostics);
+    void dumpTimeSeries_(std::vector<DiagnosticProperties*> const& diagnostics);
+    void checkTimeSeries_(std::vector<DiagnosticProperties*> const& diagnostics);
+    void writeFileAttributes_();
 
+    static bool isTimeSeries_(DiagnosticProperties const& diagnostic)
+    {
+        return diagnostic.type == "electromag" or diagnostic.type == "fluid";
+    }
+
+    template<typename Type>
+    void write_(HiFile& h5, std::string const& path, Type const* const data, std::size_t size,
+                std::size_t offset, std::size_t row = noRow)
+    {
+        if constexpr (std::is_floating_point_v<Type>)
+        {
+            auto name = path.substr(path.rfind('/') + 1);
+            if (auto bits = quantizedMantissaBits(datasetOptions_(h5), name); bits > 0)
+            {
+                quantized_.resize(size);
+                for (std::size_t i = 0; i < size; ++i)
+                    quantized_[i] = quantizeMantissa(static_cast<float>(data[i]), bits);
+                return writeSlice_(h5, path, quantized_.data(), size, offset, row);
+            }
+        }
+        writeSlice_(h5, path, data, size, offset, row);
+    }
+
+    template<typename Type>
+    void writeSlice_(HiFile& h5, std::string const& path, Type const* const data,
+                     std::size_t size, std::size_t offset, std::size_t row = noRow)
+    {
+        if (async_)
+            async_->acquire().stage(h5, path, data, size, offset, row);
+        else
+            writeDataSetSlice(h5, path, data, offset, size, row);
+    }
+
+    // collective at most once per dump, and not at all for single level dumps
+    std::size_t finestMPILevel_(std::size_t maxLocalLevel)
+    {
+        if (dumpMinLevel_ == dumpMaxLevel_)
+            return dumpMaxLevel_;
+        if (!finestLevel_)
+            finestLevel_ = core::mpi::max(maxLocalLevel);
+        return *finestLevel_;
+    }
+
+    // file attributes do not change, they are only written at the first dump of each file
+    bool needsFileAttributes_(HiFile const& h5)
+    {
+        return attributedFiles_.insert(fileName_(h5)).second;
+    }
+
+    std::string const& fileName_(HiFile const& h5) const
+    {
+        for (auto const& [name, file] : openFiles_)
+            if (file == &h5)
+                return name;
+        throw std::runtime_error("Error: h5::Writer, file not opened for the current dump");
+    }
+
+    DatasetOptions const& datasetOptions_(HiFile const& h5) const
+    {
+        static DatasetOptions const defaults{};
+        auto options = fileOptions_.find(fileName_(h5));
+        return options == fileOptions_.end() ? defaults : *options->second;
+    }
+
+    template<typename Node, typename Data>
+    static void createAttribute_(Node node, std::string const& key, Data const& value);
     void initializeDatasets_(std::vector<DiagnosticProperties*> const& diagnotics);
-    void writeDatasets_(std::vector<DiagnosticProperties*> const& diagnotics);
+    void writeDatasets_(std::vector<DiagnosticProperties*> const& diagnotics,
+                        bool attributes = true);
 
     Writer(const Writer&)             = delete;
     Writer(const Writer&&)            = delete;
@@ -180,16 +429,31 @@ private:
     friend class FluidDiagnosticWriter<This>;
     friend class ElectromagDiagnosticWriter<This>;
     friend class ParticlesDiagnosticWriter<This>;
+    friend class ReducedDiagnosticWriter<This>;
     friend class H5TypeWriter<This>;
 
     // used by friends start
+    // time series have no group per dump
     std::string getPatchPathAddTimestamp(int iLevel, std::string globalCoords)
     {
-        return getFullPatchPath(std::to_string(timestamp_), iLevel, globalCoords);
+        return getLevelPathAddTimestamp(iLevel) + "/p" + globalCoords;
+    }
+
+    std::string getLevelPathAddTimestamp(int iLevel)
+    {
+        if (timeSeriesDump_)
+            return "/pl" + std::to_string(iLevel);
+        return getFullLevelPath(std::to_string(timestamp_), iLevel);
     }
 
 
     const auto& patchPath() const { return patchPath_; }
+    auto patchLevel() const { return patchLevel_; }
+    auto& patchLayout() const { return *patchLayout_; }
+    bool levelDataSets() const { return perLevelDatasets_; }
+    bool countingLevelDataSets() const { return countingLevelDatasets_; }
+    bool needsFileAttributes(HiFile const& h5) { return needsFileAttributes_(h5); }
+    std::size_t finestMPILevel(std::size_t maxLocalLevel) { return finestMPILevel_(maxLocalLevel); }
     // used by friends end
 };
 
@@ -199,6 +463,36 @@ template<typename ModelView>
 void Writer<ModelView>::dump(std::vector<DiagnosticProperties*> const& diagnostics,
                              double timestamp)
 {
+    dumpLevels_(diagnostics, timestamp, minLevel, maxLevel);
+}
+
+
+
+/*
+ * fine level dumps only visit, create and write the datasets of their level, without
+ * communicating to find the finest level, and file attributes are not written again
+ */
+template<typename ModelView>
+void Writer<ModelView>::dump_level(std::size_t level,
+                                   std::vector<DiagnosticProperties*> const& diagnostics,
+                                   double timestamp)
+{
+    dumpLevels_(diagnostics, timestamp, level, level);
+}
+
+
+
+// nothing is done, and no communication happens, without diagnostics to write
+template<typename ModelView>
+void Writer<ModelView>::dumpLevels_(std::vector<DiagnosticProperties*> const& diagnostics,
+                                    double timestamp, std::size_t fromLevel, std::size_t toLevel)
+{
+    if (diagnostics.empty())
+        return;
+
+    dumpMinLevel_                  = fromLevel;
+    dumpMaxLevel_                  = toLevel;
+    finestLevel_                   = std::nullopt;
     timestamp_                     = timestamp;
     fileAttributes_["dimension"]   = dimension;
     fileAttributes_["interpOrder"] = interpOrder;
@@ -207,32 +501,256 @@ void Writer<ModelView>::dump(std::vector<DiagnosticProperties*> const& diagnosti
     fileAttributes_["cell_width"]  = modelView_.cellWidth();
     fileAttributes_["origin"]      = modelView_.origin();
 
-    initializeDatasets_(diagnostics);
-    flags = READ_WRITE; // don't truncate past first dump
-    writeDatasets_(diagnostics);
+    if (!async_)
+        return dump_(diagnostics);
+
+    // the snapshot is taken before locking HDF5 as waiting for a free one needs the I/O thread
+    async_->acquire();
+    {
+        std::lock_guard<std::mutex> h5Lock{async_->h5Mutex()};
+        dump_(diagnostics);
+    }
+    async_->submit();
+}
+
+
+/*
+ * Datasets and attributes are created here, collectively. In asynchronous mode, datasets are
+ * filled by the I/O thread from the staged copies, files stay open until then.
+ */
+template<typename ModelView>
+void Writer<ModelView>::dump_(std::vector<DiagnosticProperties*> const& diagnostics)
+{
+    if (perLevelDatasets_)
+        dumpLevelDatasets_(diagnostics);
+    else if (timeSeries_)
+        dumpTimeSeries_(diagnostics);
+    else
+    {
+        initializeDatasets_(diagnostics);
+        flags = READ_WRITE; // don't truncate past first dump
+        writeDatasets_(diagnostics);
+    }
 
     for (auto* diagnostic : diagnostics)
         writers.at(diagnostic->type)->finalize(*diagnostic);
+    openFiles_.clear();
+    fileOptions_.clear();
+    fileTimestamps_.clear();
 }
 
+
+
+/*
+ * Time series diagnostics write the next row of their datasets, created at their first dump with
+ * the patch and file attributes. Other diagnostics are written as with the patch layout.
+ */
 template<typename ModelView>
-void Writer<ModelView>::dump_level(std::size_t level,
-                                   std::vector<DiagnosticProperties*> const& diagnostics,
-                                   double timestamp)
+void Writer<ModelView>::dumpTimeSeries_(std::vector<DiagnosticProperties*> const& diagnostics)
 {
-    std::size_t _minLevel = this->minLevel;
-    std::size_t _maxLevel = this->maxLevel;
+    for (auto* diagnostic : diagnostics)
+        writers.at(diagnostic->type)->createFiles(*diagnostic);
+    flags = READ_WRITE; // don't truncate past first dump
 
-    this->minLevel = level;
-    this->maxLevel = level;
+    std::vector<DiagnosticProperties*> others, first, next;
+    seriesRows_.clear();
+    for (auto* diagnostic : diagnostics)
+    {
+        if (!isTimeSeries_(*diagnostic))
+        {
+            others.push_back(diagnostic);
+            continue;
+        }
+        auto const file   = fileString(diagnostic->quantity);
+        seriesRows_[file] = appendTimeStamp(*openFiles_.at(file), "/timestamps", timestamp_);
+        (seriesRows_[file] == 0 ? first : next).push_back(diagnostic);
+    }
 
-    this->dump(diagnostics, timestamp);
+    if (others.size())
+    {
+        initializeDatasets_(others);
+        writeDatasets_(others);
+    }
 
-    this->minLevel = _minLevel;
-    this->maxLevel = _maxLevel;
+    timeSeriesDump_ = true;
+    if (first.size())
+        initializeDatasets_(first);
+    checkTimeSeries_(diagnostics);
+    if (first.size())
+        writeDatasets_(first);
+    if (next.size())
+        writeDatasets_(next, /*attributes=*/false);
+    timeSeriesDump_ = false;
 }
 
 
+
+/*
+ * A first visit lists the datasets each patch writes, all must exist with the same size as at the
+ * first dump. Datasets of files that ran out of rows are extended, collectively.
+ */
+template<typename ModelView>
+void Writer<ModelView>::checkTimeSeries_(std::vector<DiagnosticProperties*> const& diagnostics)
+{
+    seriesDatasets_.clear();
+    checkingTimeSeries_ = true;
+    modelView_.visitHierarchy(
+        [&](GridLayout& layout, std::string patchID, std::size_t iLevel) {
+            patchPath_   = getPatchPathAddTimestamp(iLevel, patchID);
+            patchLevel_  = iLevel;
+            patchLayout_ = &layout;
+            for (auto* diagnostic : diagnostics)
+                if (isTimeSeries_(*diagnostic))
+                    writers.at(diagnostic->type)->write(*diagnostic);
+        },
+        dumpMinLevel_, dumpMaxLevel_);
+    checkingTimeSeries_ = false;
+
+    std::size_t mismatch = 0;
+    std::set<std::string> fullFiles;
+    for (auto const& dataset : seriesDatasets_)
+    {
+        auto& h5 = *openFiles_.at(dataset.file);
+        if (!h5.exist(dataset.path))
+        {
+            mismatch = 1;
+            continue;
+        }
+        auto const dims = h5.getDataSet(dataset.path).getDimensions();
+        if (dims.size() != 2 or dims[1] != dataset.size)
+            mismatch = 1;
+        else if (seriesRows_.at(dataset.file) >= dims[0])
+            fullFiles.insert(dataset.file);
+    }
+    if (core::mpi::max(mismatch))
+        throw std::runtime_error("Error: time_series dataset layout needs a fixed hierarchy");
+
+    // all ranks extend all the datasets of the files any rank found full
+    std::string local;
+    for (auto const& dataset : seriesDatasets_)
+        if (fullFiles.count(dataset.file))
+            local += dataset.file + '\t' + dataset.path + '\n';
+
+    std::set<std::string> toGrow;
+    for (auto const& rankDatasets : core::mpi::collect(local))
+    {
+        std::stringstream ss{std::string{rankDatasets.begin(), rankDatasets.end()}};
+        std::string line;
+        while (std::getline(ss, line, '\n'))
+            toGrow.insert(line);
+    }
+    for (auto const& line : toGrow)
+    {
+        auto const file = line.substr(0, line.find('\t'));
+        growTimeSeriesDataSet(*openFiles_.at(file), line.substr(file.size() + 1),
+                              seriesRows_.at(file));
+    }
+}
+
+
+
+/*
+ * Type writers write their patch datasets as usual, writeDataSet redirects them to the slices
+ * of the level datasets. The first visit only counts the sizes, the second one writes.
+ * Per patch datasets info and attributes are not needed, they are in the level index tables.
+ */
+template<typename ModelView>
+void Writer<ModelView>::dumpLevelDatasets_(std::vector<DiagnosticProperties*> const& diagnostics)
+{
+    for (auto* diagnostic : diagnostics)
+        writers.at(diagnostic->type)->createFiles(*diagnostic);
+    flags = READ_WRITE; // don't truncate past first dump
+
+    std::size_t maxLocalLevel = 0;
+    levelDatasets_.clear();
+    countingLevelDatasets_ = true;
+
+    auto countPatch = [&](GridLayout& layout, std::string patchID, std::size_t iLevel) {
+        levelDatasets_.addPatch(iLevel, layout.AMRBox().lower.toVector(),
+                                layout.AMRBox().upper.toVector(), layout.origin().toVector());
+        patchPath_   = getPatchPathAddTimestamp(iLevel, patchID);
+        patchLevel_  = iLevel;
+        patchLayout_ = &layout;
+        for (auto* diagnostic : diagnostics)
+            writers.at(diagnostic->type)->write(*diagnostic);
+        maxLocalLevel = iLevel;
+    };
+
+    modelView_.visitHierarchy(countPatch, dumpMinLevel_, dumpMaxLevel_);
+    countingLevelDatasets_ = false;
+
+    levelDatasets_.create(
+        [&](std::string const& name) -> HiFile& { return *openFiles_.at(name); },
+        [&](std::string const& name) -> DatasetOptions const& {
+            return datasetOptions_(*openFiles_.at(name));
+        },
+        [&](std::size_t iLevel) { return getFullLevelPath(std::to_string(timestamp_), iLevel); },
+        dumpMinLevel_, finestMPILevel_(maxLocalLevel));
+
+    auto writePatch = [&](GridLayout& layout, std::string patchID, std::size_t iLevel) {
+        levelDatasets_.selectPatch(iLevel);
+        patchPath_   = getPatchPathAddTimestamp(iLevel, patchID);
+        patchLevel_  = iLevel;
+        patchLayout_ = &layout;
+        for (auto* diagnostic : diagnostics)
+            writers.at(diagnostic->type)->write(*diagnostic);
+    };
+
+    modelView_.visitHierarchy(writePatch, dumpMinLevel_, dumpMaxLevel_);
+
+    writeFileAttributes_();
+}
+
+
+
+template<typename ModelView>
+template<typename Node, typename Data>
+void Writer<ModelView>::createAttribute_(Node node, std::string const& key, Data const& value)
+{
+    if constexpr (core::is_std_vector_v<Data>)
+        node.template createAttribute<typename Data::value_type>(key,
+                                                                 HighFive::DataSpace(value.size()))
+            .write(value.data());
+    else
+        node.template createAttribute<Data>(key, HighFive::DataSpace::From(value)).write(value);
+}
+
+
+
+// file attributes are the same on all ranks, they are written collectively once per file
+template<typename ModelView>
+void Writer<ModelView>::writeFileAttributes_()
+{
+    for (auto& [_, file] : openFiles_)
+    {
+        if (!needsFileAttributes_(*file))
+            continue;
+        auto root = file->getGroup("/");
+        fileAttributes_.visit([&](std::string const& key, auto const& value) {
+            if (!root.hasAttribute(key))
+                createAttribute_(root, key, value);
+        });
+    }
+}
+
+
+
+/*
+ * With parallel HDF5, closing a file is collective, and the I/O thread closes the files of the
+ * dumps it writes, out of step with the other ranks. Dumps are then written synchronously.
+ */
+template<typename ModelView>
+bool Writer<ModelView>::asyncWritesSupported_()
+{
+#if defined(H5_HAVE_PARALLEL)
+    PHARE_LOG(PHARE_LOG_INFO,
+              core::LogEntry{"diagnostics"}("asyncWrites", "disabled with parallel HDF5"));
+    return false;
+#else
+    return true;
+#endif
+}
+
 /*
  * Communicate all dataset paths and sizes to all MPI process to allow each to create all
  * datasets independently. This is a requirement of HDF5.
@@ -242,7 +760,8 @@ void Writer<ModelView>::dump_level(std::size_t level,
  */
 template<typename ModelView>
 template<typename Type>
-void Writer<ModelView>::createDatasetsPerMPI(HiFile& h5, std::string path, std::size_t dataSetSize)
+void Writer<ModelView>::createDatasetsPerMPI(HiFile& h5, std::string path, std::size_t dataSetSize,
+                                             DatasetOptions const& options, std::size_t rows)
 {
     int mpi_size;
     MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
@@ -252,8 +771,10 @@ void Writer<ModelView>::createDatasetsPerMPI(HiFile& h5, std::string path, std::
     {
         if (sizes[i] == 0)
             continue;
-        H5Easy::detail::createGroupsToDataSet(h5, paths[i]);
-        h5.createDataSet<Type>(paths[i], HighFive::DataSpace(sizes[i]));
+        if (rows > 0)
+            h5::createTimeSeriesDataSet<Type>(h5, paths[i], rows, sizes[i], options);
+        else
+            h5::createDataSet<Type>(h5, paths[i], sizes[i], options);
     }
 }
 
@@ -325,7 +846,8 @@ void Writer<ModelView>::initializeDatasets_(std::vector<DiagnosticProperties*> c
     for (auto* diag : diagnostics)
         writers.at(diag->type)->createFiles(*diag);
 
-    auto collectPatchAttributes = [&](GridLayout&, std::string patchID, std::size_t iLevel) {
+    auto collectPatchAttributes = [&](GridLayout& layout, std::string patchID, std::size_t iLevel) {
+        patchLayout_ = &layout;
         if (!lvlPatchIDs.count(iLevel))
             lvlPatchIDs.emplace(iLevel, std::vector<std::string>());
 
@@ -338,11 +860,11 @@ void Writer<ModelView>::initializeDatasets_(std::vector<DiagnosticProperties*> c
         maxLocalLevel = iLevel;
     };
 
-    modelView_.visitHierarchy(collectPatchAttributes, minLevel, maxLevel);
+    modelView_.visitHierarchy(collectPatchAttributes, dumpMinLevel_, dumpMaxLevel_);
 
     // sets empty vectors in case current process lacks patch on a level
-    std::size_t maxMPILevel = core::mpi::max(maxLocalLevel);
-    for (std::size_t lvl = minLevel; lvl <= maxMPILevel; lvl++)
+    std::size_t maxMPILevel = finestMPILevel_(maxLocalLevel);
+    for (std::size_t lvl = dumpMinLevel_; lvl <= maxMPILevel; lvl++)
         if (!lvlPatchIDs.count(lvl))
             lvlPatchIDs.emplace(lvl, std::vector<std::string>());
 
@@ -355,8 +877,10 @@ void Writer<ModelView>::initializeDatasets_(std::vector<DiagnosticProperties*> c
 
 
 
+// attributes are not written again when appending to time series
 template<typename ModelView>
-void Writer<ModelView>::writeDatasets_(std::vector<DiagnosticProperties*> const& diagnostics)
+void Writer<ModelView>::writeDatasets_(std::vector<DiagnosticProperties*> const& diagnostics,
+                                       bool attributes)
 {
     std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>
         patchAttributes;
@@ -365,18 +889,22 @@ void Writer<ModelView>::writeDatasets_(std::vector<DiagnosticProperties*> const&
     auto writePatch = [&](GridLayout& gridLayout, std::string patchID, std::size_t iLevel) {
         if (!patchAttributes.count(iLevel))
             patchAttributes.emplace(iLevel, std::vector<std::pair<std::string, Attributes>>{});
-        patchPath_ = getPatchPathAddTimestamp(iLevel, patchID);
+        patchPath_   = getPatchPathAddTimestamp(iLevel, patchID);
+        patchLevel_  = iLevel;
+        patchLayout_ = &gridLayout;
         patchAttributes[iLevel].emplace_back(patchID, modelView_.getPatchProperties(gridLayout));
         for (auto* diagnostic : diagnostics)
             writers.at(diagnostic->type)->write(*diagnostic);
         maxLocalLevel = iLevel;
     };
 
-    modelView_.visitHierarchy(writePatch, minLevel, maxLevel);
+    modelView_.visitHierarchy(writePatch, dumpMinLevel_, dumpMaxLevel_);
+    if (!attributes)
+        return;
 
-    std::size_t maxMPILevel = core::mpi::max(maxLocalLevel);
+    std::size_t maxMPILevel = finestMPILevel_(maxLocalLevel);
     // sets empty vectors in case current process lacks patch on a level
-    for (std::size_t lvl = minLevel; lvl <= maxMPILevel; lvl++)
+    for (std::size_t lvl = dumpMinLevel_; lvl <= maxMPILevel; lvl++)
         if (!patchAttributes.count(lvl))
             patchAttributes.emplace(lvl, std::vector<std::pair<std::string, Attributes>>{});
 
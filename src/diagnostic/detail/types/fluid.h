@@ -198,7 +198,9 @@ void FluidDiagnosticWriter<HighFiveDiagnostic>::write(DiagnosticProperties& diag
     auto& file = fileData.at(diagnostic.quantity)->file();
 
     auto checkActive = [&](auto& tree, auto var) { return diagnostic.quantity == tree + var; };
-    auto writeDS     = [&](auto path, auto& field) { hi5.writeDataSet(file, path, field.data()); };
+    auto writeDS     = [&](auto path, auto& field) {
+        hi5.writeDataSet(file, path, field.data(), field.size());
+    };
     auto writeVF     = [&](auto path, auto& vecF) { hi5.writeVecFieldAsDataset(file, path, vecF); };
 
     std::string path = hi5.patchPath() + "/";
@@ -4,6 +4,7 @@
 #include "diagnostic/detail/h5file.h"
 #include "diagnostic/detail/h5typewriter.h"
 #include "diagnostic/detail/h5_utils.h"
+#include "diagnostic/particle_selection.h"
 
 #include "core/data/particles/particle_packer.h"
 
@@ -12,6 +13,7 @@
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <array>
 
 namespace PHARE::diagnostic::h5
 {
@@ -23,6 +25,14 @@ namespace PHARE::diagnostic::h5
  * /t#/pl#/p#/ions/pop_(1,2,...)/domain/(weight, charge, iCell, delta, v)
  * /t#/pl#/p#/ions/pop_(1,2,...)/levelGhost/(weight, charge, iCell, delta, v)
  * /t#/pl#/p#/ions/pop_(1,2,...)/patchGhost/(weight, charge, iCell, delta, v)
+ *
+ * Only the particles selected by the ParticleSelectionOptions of the diagnostic are written, they
+ * are selected by index before being copied.
+ *
+ * Particles are packed in a staging buffer per diagnostic, kept between dumps.
+ * With level datasets, all the particles of a level are packed before being written, which is
+ * one write per attribute, level and rank, as the patches of a rank are contiguous in the level
+ * datasets.
  */
 template<typename HighFiveDiagnostic>
 class ParticlesDiagnosticWriter : public H5TypeWriter<HighFiveDiagnostic>
@@ -63,8 +73,65 @@ public:
     void finalize(DiagnosticProperties& diagnostic) override;
 
 private:
+    struct Staging
+    {
+        core::ContiguousParticles<dimension> particles{0};
+        std::size_t size = 0; // staged particles, the buffers may be larger
+
+        // level dataset layout, staged particles are written from those offsets
+        HiFile* file      = nullptr;
+        std::size_t level = 0;
+        std::array<std::size_t, 5> offsets{};
+    };
+
+    // calls fn(attribute index, buffer, components per particle) for each particle attribute
+    template<typename Fn>
+    static void visitAttributes_(core::ContiguousParticles<dimension>& particles, Fn&& fn)
+    {
+        fn(0, particles.weight, 1);
+        fn(1, particles.charge, 1);
+        fn(2, particles.iCell, dimension);
+        fn(3, particles.delta, dimension);
+        fn(4, particles.v, 3);
+    }
+
+    // buffers only grow, so that they are not reallocated at each dump
+    static void reserve_(Staging& staging, std::size_t size)
+    {
+        visitAttributes_(staging.particles, [&](auto, auto& buffer, std::size_t components) {
+            if (buffer.size() < size * components)
+                buffer.resize(size * components);
+        });
+    }
+
+    void writeStagedLevel_(Staging& staging);
+
+    // selects the particles of the current patch the diagnostic writes, returns their number
+    template<typename Particles>
+    std::size_t select_(DiagnosticProperties const& diagnostic, Particles const& particles)
+    {
+        selectsAll_ = selectsAll(diagnostic.selection);
+        if (selectsAll_)
+            return particles.size();
+        selectParticles(diagnostic.selection, particles, this->hi5_.patchLayout(), selected_);
+        return selected_.size();
+    }
+
+    // packs the particles selected by the last call to select_ from index start
+    template<typename Particles>
+    void pack_(Particles const& particles, Staging& staging, std::size_t start)
+    {
+        if (selectsAll_)
+            Packer{particles}.pack(staging.particles, start);
+        else
+            Packer{particles}.pack(staging.particles, selected_, start);
+    }
+
     std::size_t levels_ = 0;
     std::unordered_map<std::string, std::unique_ptr<HighFiveFile>> fileData;
+    std::unordered_map<std::string, Staging> staging_;
+    std::vector<std::size_t> selected_; // indexes of the selected particles of the current patch
+    bool selectsAll_ = true;
 };
 
 
@@ -95,10 +162,10 @@ void ParticlesDiagnosticWriter<HighFiveDiagnostic>::getDataSetInfo(DiagnosticPro
             return 1; /* not an array so value one of type ValueType*/
     };
 
-    auto particleInfo = [&](auto& attr, auto& particles) {
+    auto particleInfo = [&](auto& attr, std::size_t nbrParticles) {
         std::size_t part_idx = 0;
         core::apply(Packer::empty(), [&](auto const& arg) {
-            attr[Packer::keys()[part_idx]] = getSize(arg) * particles.size();
+            attr[Packer::keys()[part_idx]] = getSize(arg) * nbrParticles;
             part_idx++;
         });
     };
@@ -106,7 +173,7 @@ void ParticlesDiagnosticWriter<HighFiveDiagnostic>::getDataSetInfo(DiagnosticPro
     auto checkInfo = [&](auto& tree, auto pType, auto& attr, auto& ps) {
         std::string active{tree + pType};
         if (diagnostic.quantity == active)
-            particleInfo(attr[pType], ps);
+            particleInfo(attr[pType], select_(diagnostic, ps));
     };
 
     for (auto& pop : hi5.modelView().getIons())
@@ -176,18 +243,50 @@ void ParticlesDiagnosticWriter<HighFiveDiagnostic>::write(DiagnosticProperties&
     auto& hi5 = this->hi5_;
 
     auto writeParticles = [&](auto path, auto& particles) {
-        if (particles.size() == 0)
+        auto const nbrParticles = select_(diagnostic, particles);
+        if (nbrParticles == 0)
             return;
-        auto& hfile = fileData.at(diagnostic.quantity)->file();
-        Packer packer(particles);
-        core::ContiguousParticles<dimension> copy{particles.size()};
-        packer.pack(copy);
-
-        hi5.writeDataSet(hfile, path + packer.keys()[0], copy.weight.data());
-        hi5.writeDataSet(hfile, path + packer.keys()[1], copy.charge.data());
-        hi5.writeDataSet(hfile, path + packer.keys()[2], copy.iCell.data());
-        hi5.writeDataSet(hfile, path + packer.keys()[3], copy.delta.data());
-        hi5.writeDataSet(hfile, path + packer.keys()[4], copy.v.data());
+        auto& hfile   = fileData.at(diagnostic.quantity)->file();
+        auto& staging = staging_[diagnostic.quantity];
+
+        if (!hi5.levelDataSets())
+        {
+            reserve_(staging, nbrParticles);
+            pack_(particles, staging, 0);
+            visitAttributes_(staging.particles, [&](auto i, auto& buffer, auto components) {
+                hi5.writeDataSet(hfile, path + Packer::keys()[i], buffer.data(),
+                                 nbrParticles * components);
+            });
+            return;
+        }
+
+        if (hi5.countingLevelDataSets())
+        {
+            visitAttributes_(staging.particles, [&](auto i, auto& buffer, auto components) {
+                using Type = typename std::decay_t<decltype(buffer)>::value_type;
+                hi5.template countLevelDataSet<Type>(hfile, Packer::keys()[i],
+                                                     nbrParticles * components);
+            });
+            return;
+        }
+
+        if (staging.size > 0 and staging.level != hi5.patchLevel())
+            writeStagedLevel_(staging);
+
+        if (staging.size == 0) // first patch of the level, the others follow contiguously
+        {
+            staging.file  = &hfile;
+            staging.level = hi5.patchLevel();
+            visitAttributes_(staging.particles, [&](auto i, auto& buffer, auto) {
+                using Type = typename std::decay_t<decltype(buffer)>::value_type;
+                staging.offsets[i]
+                    = hi5.template levelDataSetOffset<Type>(hfile, Packer::keys()[i]);
+            });
+        }
+
+        reserve_(staging, staging.size + nbrParticles);
+        pack_(particles, staging, staging.size);
+        staging.size += nbrParticles;
     };
 
     auto checkWrite = [&](auto& tree, auto pType, auto& ps) {
@@ -218,9 +317,25 @@ void ParticlesDiagnosticWriter<HighFiveDiagnostic>::writeAttributes(
 }
 
 
+template<typename HighFiveDiagnostic>
+void ParticlesDiagnosticWriter<HighFiveDiagnostic>::writeStagedLevel_(Staging& staging)
+{
+    visitAttributes_(staging.particles, [&](auto i, auto& buffer, auto components) {
+        this->hi5_.writeLevelDataSet(*staging.file, staging.level, Packer::keys()[i],
+                                     buffer.data(), staging.size * components,
+                                     staging.offsets[i]);
+    });
+    staging.size = 0;
+}
+
+
+
 template<typename HighFiveDiagnostic>
 void ParticlesDiagnosticWriter<HighFiveDiagnostic>::finalize(DiagnosticProperties& diagnostic)
 {
+    if (staging_.count(diagnostic.quantity) and staging_[diagnostic.quantity].size > 0)
+        writeStagedLevel_(staging_[diagnostic.quantity]);
+
     fileData.erase(diagnostic.quantity);
     assert(fileData.count(diagnostic.quantity) == 0);
 }
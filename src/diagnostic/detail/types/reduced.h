@@ -0,0 +1,474 @@
+#ifndef PHARE_DIAGNOSTIC_DETAIL_TYPES_REDUCED_H
+#define PHARE_DIAGNOSTIC_DETAIL_TYPES_REDUCED_H
+
+#include "diagnostic/detail/h5file.h"
+#include "diagnostic/detail/h5typewriter.h"
+#include "diagnostic/detail/h5_utils.h"
+
+#include "core/data/grid/gridlayoutdefs.h"
+#include "core/data/vecfield/vecfield_component.h"
+#include "core/utilities/mpi_utils.h"
+
+#include <map>
+#include <array>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace PHARE::diagnostic::h5
+{
+/*
+ * Reduced diagnostics are computed in situ while visiting the patches, summed over all MPI
+ * processes and written by the first one only, so that they are small enough to be written often
+ *
+ * Possible outputs
+ *
+ * /energy                                    : /t#/pl#/(magnetic, electric)
+ *                                              /t#/pl#/<pop>/(kinetic, thermal)
+ * /ions/pop/<pop>/velocity_distribution      : /t#/pl#/(vx, vy, vz), one histogram per axis
+ * /ions/pop/<pop>/phase_space                : /t#/pl#/histogram, over all axes, the last one
+ *                                              varying fastest
+ *
+ * Energies are integrated over the domain of each level, the thermal energy being the kinetic
+ * energy in the frame of the local bulk velocity of the population, that of the particles of each
+ * cell, so that a bulk velocity varying in space is not counted as thermal. Histograms bin the
+ * domain particles, weighted by their weights, particles out of the ranges are not counted. The
+ * axes, number of bins and ranges of a histogram are attributes of its file.
+ */
+template<typename HighFiveDiagnostic>
+class ReducedDiagnosticWriter : public H5TypeWriter<HighFiveDiagnostic>
+{
+public:
+    using Super = H5TypeWriter<HighFiveDiagnostic>;
+    using Super::checkCreateFileFor_;
+    using Super::hi5_;
+    using Attributes                = typename Super::Attributes;
+    using GridLayout                = typename HighFiveDiagnostic::GridLayout;
+    static constexpr auto dimension = HighFiveDiagnostic::dimension;
+
+    ReducedDiagnosticWriter(HighFiveDiagnostic& hi5)
+        : H5TypeWriter<HighFiveDiagnostic>(hi5)
+    {
+    }
+    void write(DiagnosticProperties&) override;
+    void compute(DiagnosticProperties&) override {}
+
+    void createFiles(DiagnosticProperties& diagnostic) override;
+
+    void getDataSetInfo(DiagnosticProperties&, std::size_t, std::string const&,
+                        Attributes&) override
+    {
+    }
+
+    void initDataSets(DiagnosticProperties&,
+                      std::unordered_map<std::size_t, std::vector<std::string>> const&,
+                      Attributes&, std::size_t) override
+    {
+    }
+
+    void writeAttributes(
+        DiagnosticProperties&, Attributes&,
+        std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>&,
+        std::size_t maxLevel) override;
+
+    void finalize(DiagnosticProperties& diagnostic) override;
+
+private:
+    static constexpr std::size_t nbrFieldEnergies = 2; // magnetic, electric
+    static constexpr std::size_t nbrPopSums       = 2; // kinetic and thermal energies
+
+    // axis of a histogram, 0 to 2 for positions, 3 to 5 for velocities
+    static std::size_t axisIndex_(std::string const& axis);
+    static void checkHistogram_(HistogramOptions const& histogram);
+
+    std::size_t nbrValues_(DiagnosticProperties const& diagnostic) const;
+
+    template<typename Field>
+    static double sumSquares_(GridLayout const& layout, Field const& field);
+
+    void addEnergies_(std::vector<double>& sums);
+
+    template<typename Particles>
+    static void addHistograms_(HistogramOptions const& histogram, bool product,
+                               Particles const& particles, GridLayout const& layout,
+                               std::vector<double>& sums);
+
+    std::vector<std::pair<std::string, std::vector<double>>>
+    outputs_(DiagnosticProperties const& diagnostic, std::vector<double> const& totals) const;
+
+    std::unordered_map<std::string, std::unique_ptr<HighFiveFile>> fileData;
+    std::unordered_map<std::string, std::map<std::size_t, std::vector<double>>> sums_; // by level
+    std::vector<double> cellSums_; // mass, momentum and kinetic energy per cell of a patch
+};
+
+
+
+template<typename HighFiveDiagnostic>
+void ReducedDiagnosticWriter<HighFiveDiagnostic>::createFiles(DiagnosticProperties& diagnostic)
+{
+    for (auto const& pop : this->hi5_.modelView().getIons())
+    {
+        std::string tree{"/ions/pop/" + pop.name() + "/"};
+        checkCreateFileFor_(diagnostic, fileData, tree, "velocity_distribution", "phase_space");
+    }
+    checkCreateFileFor_(diagnostic, fileData, "/", "energy");
+
+    if (diagnostic.quantity != "/energy")
+        checkHistogram_(diagnostic.histogram);
+}
+
+
+
+template<typename HighFiveDiagnostic>
+void ReducedDiagnosticWriter<HighFiveDiagnostic>::write(DiagnosticProperties& diagnostic)
+{
+    auto& hi5 = this->hi5_;
+    if (hi5.countingLevelDataSets()) // nothing to write in the level datasets
+        return;
+
+    auto& sums = sums_[diagnostic.quantity][hi5.patchLevel()];
+    sums.resize(nbrValues_(diagnostic), 0.);
+
+    if (diagnostic.quantity == "/energy")
+        return addEnergies_(sums);
+
+    for (auto& pop : hi5.modelView().getIons())
+    {
+        std::string tree{"/ions/pop/" + pop.name() + "/"};
+        if (diagnostic.quantity == tree + "velocity_distribution")
+            addHistograms_(diagnostic.histogram, false, pop.domainParticles(), hi5.patchLayout(),
+                           sums);
+        else if (diagnostic.quantity == tree + "phase_space")
+            addHistograms_(diagnostic.histogram, true, pop.domainParticles(), hi5.patchLayout(),
+                           sums);
+    }
+}
+
+
+
+template<typename HighFiveDiagnostic>
+void ReducedDiagnosticWriter<HighFiveDiagnostic>::writeAttributes(
+    DiagnosticProperties& diagnostic, Attributes& fileAttributes,
+    std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>&,
+    std::size_t)
+{
+    auto& file = fileData.at(diagnostic.quantity)->file();
+    if (this->hi5_.needsFileAttributes(file))
+        this->hi5_.writeAttributeDict(file, fileAttributes, "/");
+}
+
+
+
+/*
+ * sums over all MPI processes, then creates the datasets on all of them, which is collective, and
+ * writes them from the first one
+ */
+template<typename HighFiveDiagnostic>
+void ReducedDiagnosticWriter<HighFiveDiagnostic>::finalize(DiagnosticProperties& diagnostic)
+{
+    auto& hi5      = this->hi5_;
+    auto& file     = fileData.at(diagnostic.quantity)->file();
+    auto& sums     = sums_[diagnostic.quantity];
+    auto maxLevel  = hi5.finestMPILevel(sums.empty() ? hi5.dumpMinLevel() : sums.rbegin()->first);
+    bool const io  = core::mpi::rank() == 0;
+    auto nbrValues = nbrValues_(diagnostic);
+
+    for (std::size_t lvl = hi5.dumpMinLevel(); lvl <= maxLevel; ++lvl)
+    {
+        auto& local = sums[lvl];
+        local.resize(nbrValues, 0.);
+
+        for (auto const& [name, values] : outputs_(diagnostic, core::mpi::sum(local)))
+        {
+            createDataSet<double>(file, hi5.getLevelPathAddTimestamp(lvl) + "/" + name,
+                                  values.size(), diagnostic.datasetOptions);
+            if (io)
+                hi5.writeLevelDataSet(file, lvl, name, values.data(), values.size(), 0);
+        }
+    }
+
+    if (diagnostic.quantity != "/energy")
+    {
+        auto root             = file.getGroup("/");
+        auto const& histogram = diagnostic.histogram;
+        std::string axes;
+        for (auto const& axis : histogram.axes)
+            axes += (axes.empty() ? "" : ",") + axis;
+
+        if (!root.hasAttribute("axes"))
+        {
+            HighFiveDiagnostic::createAttribute_(root, "axes", axes);
+            HighFiveDiagnostic::createAttribute_(root, "nbr_bins", histogram.nbrBins);
+            HighFiveDiagnostic::createAttribute_(root, "ranges", histogram.ranges);
+        }
+    }
+
+    sums_.erase(diagnostic.quantity);
+    fileData.erase(diagnostic.quantity);
+    assert(fileData.count(diagnostic.quantity) == 0);
+}
+
+
+
+template<typename HighFiveDiagnostic>
+std::size_t ReducedDiagnosticWriter<HighFiveDiagnostic>::axisIndex_(std::string const& axis)
+{
+    std::array<std::string, 6> const axes{"x", "y", "z", "vx", "vy", "vz"};
+    for (std::size_t i = 0; i < axes.size(); ++i)
+        if (axis == axes[i] and (i >= 3 or i < dimension))
+            return i;
+    throw std::runtime_error("Error: reduced diagnostic, invalid histogram axis " + axis);
+}
+
+
+
+template<typename HighFiveDiagnostic>
+void ReducedDiagnosticWriter<HighFiveDiagnostic>::checkHistogram_(
+    HistogramOptions const& histogram)
+{
+    auto const nbrAxes = histogram.axes.size();
+    if (nbrAxes == 0 or histogram.nbrBins.size() != nbrAxes
+        or histogram.ranges.size() != 2 * nbrAxes)
+        throw std::runtime_error("Error: reduced diagnostic, histograms need bins and ranges "
+                                 "for each axis");
+
+    for (std::size_t i = 0; i < nbrAxes; ++i)
+    {
+        axisIndex_(histogram.axes[i]);
+        if (histogram.nbrBins[i] == 0 or histogram.ranges[2 * i] >= histogram.ranges[2 * i + 1])
+            throw std::runtime_error("Error: reduced diagnostic, invalid binning of axis "
+                                     + histogram.axes[i]);
+    }
+}
+
+
+
+template<typename HighFiveDiagnostic>
+std::size_t ReducedDiagnosticWriter<HighFiveDiagnostic>::nbrValues_(
+    DiagnosticProperties const& diagnostic) const
+{
+    auto const& nbrBins = diagnostic.histogram.nbrBins;
+
+    if (diagnostic.quantity == "/energy")
+        return nbrFieldEnergies + nbrPopSums * this->hi5_.modelView().getIons().nbrPopulations();
+
+    std::size_t nbrValues = 0, product = 1;
+    for (auto bins : nbrBins)
+    {
+        nbrValues += bins;
+        product *= bins;
+    }
+    return diagnostic.quantity.rfind("phase_space") != std::string::npos ? product : nbrValues;
+}
+
+
+
+/*
+ * sum of the squares of the field on the domain nodes of the patch, primal nodes on the upper
+ * border of the patch are left to the neighbour patch, so that shared nodes are counted once
+ */
+template<typename HighFiveDiagnostic>
+template<typename Field>
+double ReducedDiagnosticWriter<HighFiveDiagnostic>::sumSquares_(GridLayout const& layout,
+                                                                Field const& field)
+{
+    auto const centering = GridLayout::centering(field.physicalQuantity());
+    std::array<std::uint32_t, dimension> start, end; // end excluded
+    for (std::size_t i = 0; i < dimension; ++i)
+    {
+        auto const direction = static_cast<core::Direction>(i);
+        start[i]             = layout.physicalStartIndex(field, direction);
+        end[i]               = layout.physicalEndIndex(field, direction)
+                 + (centering[i] == core::QtyCentering::dual ? 1 : 0);
+    }
+
+    double sum = 0.;
+    if constexpr (dimension == 1)
+    {
+        for (auto ix = start[0]; ix < end[0]; ++ix)
+            sum += field(ix) * field(ix);
+    }
+    else if constexpr (dimension == 2)
+    {
+        for (auto ix = start[0]; ix < end[0]; ++ix)
+            for (auto iy = start[1]; iy < end[1]; ++iy)
+                sum += field(ix, iy) * field(ix, iy);
+    }
+    else
+    {
+        for (auto ix = start[0]; ix < end[0]; ++ix)
+            for (auto iy = start[1]; iy < end[1]; ++iy)
+                for (auto iz = start[2]; iz < end[2]; ++iz)
+                    sum += field(ix, iy, iz) * field(ix, iy, iz);
+    }
+    return sum;
+}
+
+
+
+/*
+ * sums are: magnetic and electric energies, then kinetic and thermal energies per population.
+ * The thermal energy of a cell is its kinetic energy minus that of its bulk motion, each cell
+ * being in a single patch, the thermal energies of cells add up over patches and MPI processes
+ */
+template<typename HighFiveDiagnostic>
+void ReducedDiagnosticWriter<HighFiveDiagnostic>::addEnergies_(std::vector<double>& sums)
+{
+    auto& modelView    = this->hi5_.modelView();
+    auto const& layout = this->hi5_.patchLayout();
+    auto const box     = layout.AMRBox();
+
+    // index of the cell of a domain particle in the patch
+    std::size_t nbrCells = 1;
+    for (std::size_t i = 0; i < dimension; ++i)
+        nbrCells *= box.upper[i] - box.lower[i] + 1;
+    auto cellIndex = [&](auto const& particle) {
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < dimension; ++i)
+        {
+            assert(particle.iCell[i] >= box.lower[i] and particle.iCell[i] <= box.upper[i]);
+            index = index * (box.upper[i] - box.lower[i] + 1) + (particle.iCell[i] - box.lower[i]);
+        }
+        return index;
+    };
+
+    auto fields = modelView.getElectromagFields(); // B, E
+    for (std::size_t iField = 0; iField < nbrFieldEnergies; ++iField)
+        for (auto& [_, component] : core::Components::componentMap)
+            sums[iField] += 0.5 * layout.cellVolume()
+                            * sumSquares_(layout, fields[iField]->getComponent(component));
+
+    std::size_t iPop = 0;
+    for (auto& pop : modelView.getIons())
+    {
+        auto* popSums = sums.data() + nbrFieldEnergies + nbrPopSums * iPop++;
+
+        cellSums_.assign(5 * nbrCells, 0.);
+        for (auto const& particle : pop.domainParticles())
+        {
+            auto* cell      = cellSums_.data() + 5 * cellIndex(particle);
+            auto const mass = pop.mass() * particle.weight;
+            auto const& v   = particle.v;
+            cell[0] += mass;
+            for (std::size_t i = 0; i < 3; ++i)
+                cell[1 + i] += mass * v[i];
+            cell[4] += 0.5 * mass * (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        }
+
+        for (std::size_t iCell = 0; iCell < nbrCells; ++iCell)
+        {
+            auto const* cell = cellSums_.data() + 5 * iCell;
+            if (cell[0] <= 0.)
+                continue;
+            auto const momentum2 = cell[1] * cell[1] + cell[2] * cell[2] + cell[3] * cell[3];
+            popSums[0] += cell[4];
+            popSums[1] += cell[4] - 0.5 * momentum2 / cell[0];
+        }
+    }
+}
+
+
+
+/*
+ * one histogram per axis, one after the other, or a single histogram over all axes if product
+ */
+template<typename HighFiveDiagnostic>
+template<typename Particles>
+void ReducedDiagnosticWriter<HighFiveDiagnostic>::addHistograms_(
+    HistogramOptions const& histogram, bool product, Particles const& particles,
+    GridLayout const& layout, std::vector<double>& sums)
+{
+    auto const nbrAxes = histogram.axes.size();
+    std::vector<std::size_t> axes(nbrAxes);
+    for (std::size_t i = 0; i < nbrAxes; ++i)
+        axes[i] = axisIndex_(histogram.axes[i]);
+
+    auto const& origin   = layout.origin();
+    auto const& meshSize = layout.meshSize();
+    auto const& lower    = layout.AMRBox().lower;
+
+    // bin of the particle on the given axis, nbrBins if out of range
+    auto bin = [&](auto const& particle, std::size_t i) {
+        auto const axis = axes[i];
+        double value    = axis < 3 ? origin[axis]
+                                      + (particle.iCell[axis] - lower[axis] + particle.delta[axis])
+                                            * meshSize[axis]
+                                   : particle.v[axis - 3];
+
+        auto const min = histogram.ranges[2 * i], max = histogram.ranges[2 * i + 1];
+        if (value < min or value >= max)
+            return histogram.nbrBins[i];
+        auto const nbrBins = histogram.nbrBins[i];
+        auto const iBin    = static_cast<std::size_t>((value - min) / (max - min) * nbrBins);
+        return std::min(iBin, nbrBins - 1); // values close to max may be rounded up
+    };
+
+    for (auto const& particle : particles)
+    {
+        std::size_t first = 0, index = 0;
+        bool inRange = true;
+        for (std::size_t i = 0; i < nbrAxes; ++i)
+        {
+            auto const iBin = bin(particle, i);
+            if (!product)
+            {
+                if (iBin < histogram.nbrBins[i])
+                    sums[first + iBin] += particle.weight;
+                first += histogram.nbrBins[i];
+                continue;
+            }
+            inRange = inRange and iBin < histogram.nbrBins[i];
+            index   = index * histogram.nbrBins[i] + iBin;
+        }
+        if (product and inRange)
+            sums[index] += particle.weight;
+    }
+}
+
+
+
+template<typename HighFiveDiagnostic>
+std::vector<std::pair<std::string, std::vector<double>>>
+ReducedDiagnosticWriter<HighFiveDiagnostic>::outputs_(DiagnosticProperties const& diagnostic,
+                                                      std::vector<double> const& totals) const
+{
+    std::vector<std::pair<std::string, std::vector<double>>> outputs;
+    auto const& histogram = diagnostic.histogram;
+
+    if (diagnostic.quantity == "/energy")
+    {
+        outputs.emplace_back("magnetic", std::vector<double>{totals[0]});
+        outputs.emplace_back("electric", std::vector<double>{totals[1]});
+
+        std::size_t iPop = 0;
+        for (auto const& pop : this->hi5_.modelView().getIons())
+        {
+            auto const* popTotals = totals.data() + nbrFieldEnergies + nbrPopSums * iPop++;
+            outputs.emplace_back(pop.name() + "/kinetic", std::vector<double>{popTotals[0]});
+            outputs.emplace_back(pop.name() + "/thermal", std::vector<double>{popTotals[1]});
+        }
+    }
+    else if (diagnostic.quantity.rfind("phase_space") != std::string::npos)
+        outputs.emplace_back("histogram", totals);
+    else
+    {
+        auto first = totals.begin();
+        for (std::size_t i = 0; i < histogram.axes.size(); ++i)
+        {
+            outputs.emplace_back(histogram.axes[i],
+                                 std::vector<double>(first, first + histogram.nbrBins[i]));
+            first += histogram.nbrBins[i];
+        }
+    }
+    return outputs;
+}
+
+
+} // namespace PHARE::diagnostic::h5
+
+#endif /* PHARE_DIAGNOSTIC_DETAIL_TYPES_REDUCED_H */
@@ -5,7 +5,9 @@
 #include "core/data/particles/particle_array.h"
 #include "initializer/data_provider.h"
 #include "diagnostic_props.h"
+#include "core/timers.h"
 
+#include <sstream>
 #include <utility>
 
 namespace PHARE::diagnostic
@@ -17,7 +19,7 @@ enum class Mode { LIGHT, FULL };
 template<typename DiagManager>
 void registerDiagnostics(DiagManager& dMan, PHARE::initializer::PHAREDict& diagsParams)
 {
-    std::vector<std::string> const diagTypes = {"fluid", "electromag", "particle"};
+    std::vector<std::string> const diagTypes = {"fluid", "electromag", "particle", "reduced"};
 
     for (auto& diagType : diagTypes)
     {
@@ -40,6 +42,7 @@ class IDiagnosticsManager
 public:
     virtual void dump(double timeStamp, double timeStep)         = 0;
     virtual void dump_level(std::size_t level, double timeStamp) = 0;
+    virtual void flush() {} // waits for the dumps still being written, if any
     inline virtual ~IDiagnosticsManager();
 };
 IDiagnosticsManager::~IDiagnosticsManager() {}
@@ -68,6 +71,7 @@ public:
 
     void dump(double timeStamp, double timeStep) override;
     void dump_level(std::size_t level, double timeStamp) override;
+    void flush() override { writer_->flush(); }
 
     DiagnosticsManager& addDiagDict(PHARE::initializer::PHAREDict& dict);
 
@@ -81,23 +85,26 @@ public:
     void addDiagnostic(DiagnosticProperties& diagnostic)
     {
         diagnostics_.emplace_back(diagnostic);
-        nextWrite_[diagnostic.type + diagnostic.quantity]   = -1;
-        nextCompute_[diagnostic.type + diagnostic.quantity] = -1;
+        nextWrite_[diagnostic.type + diagnostic.quantity]   = 0;
+        nextCompute_[diagnostic.type + diagnostic.quantity] = 0;
     }
 
     auto& diagnostics() const { return diagnostics_; }
 
 
+    // false once all the timestamps of the diagnostic are done
     bool needsWrite(DiagnosticProperties& diag, double timeStamp, double timeStep)
     {
         auto nextWrite = nextWrite_[diag.type + diag.quantity];
-        return timeStamp + timeStep > diag.writeTimestamps[nextWrite];
+        return nextWrite < diag.writeTimestamps.size()
+               and timeStamp + timeStep > diag.writeTimestamps[nextWrite];
     }
 
     bool needsCompute(DiagnosticProperties& diag, double timeStamp, double timeStep)
     {
         auto nextCompute = nextCompute_[diag.type + diag.quantity];
-        return timeStamp + timeStep > diag.computeTimestamps[nextCompute];
+        return nextCompute < diag.computeTimestamps.size()
+               and timeStamp + timeStep > diag.computeTimestamps[nextCompute];
     }
 
     Writer& writer() { return *writer_.get(); }
@@ -132,6 +139,48 @@ DiagnosticsManager<Writer>::addDiagDict(PHARE::initializer::PHAREDict& diagInput
     diagProps.computeTimestamps
         = diagInputs["compute_timestamps"].template to<std::vector<double>>();
 
+    auto& options = diagProps.datasetOptions;
+    if (diagInputs.contains("chunk_size"))
+        options.chunkSize = diagInputs["chunk_size"].template to<int>();
+    if (diagInputs.contains("gzip"))
+        options.gzipLevel = diagInputs["gzip"].template to<int>();
+    if (diagInputs.contains("shuffle"))
+        options.shuffle = diagInputs["shuffle"].template to<int>() > 0;
+    if (diagInputs.contains("mantissa_bits"))
+        options.mantissaBits = diagInputs["mantissa_bits"].template to<int>();
+    if (diagInputs.contains("quantized_datasets"))
+    {
+        std::stringstream datasets{diagInputs["quantized_datasets"].template to<std::string>()};
+        std::string dataset;
+        while (std::getline(datasets, dataset, ','))
+            options.quantizedDatasets.emplace_back(dataset);
+    }
+    Writer::checkDatasetOptions(options);
+
+    auto& histogram = diagProps.histogram;
+    if (diagInputs.contains("axes"))
+    {
+        std::stringstream axes{diagInputs["axes"].template to<std::string>()};
+        std::string axis;
+        while (std::getline(axes, axis, ','))
+            histogram.axes.emplace_back(axis);
+    }
+    if (diagInputs.contains("nbr_bins"))
+        for (auto nbrBins : diagInputs["nbr_bins"].template to<std::vector<double>>())
+            histogram.nbrBins.emplace_back(static_cast<std::size_t>(nbrBins));
+    if (diagInputs.contains("ranges"))
+        histogram.ranges = diagInputs["ranges"].template to<std::vector<double>>();
+
+    auto& selection = diagProps.selection;
+    if (diagInputs.contains("selection_box"))
+        selection.box = diagInputs["selection_box"].template to<std::vector<double>>();
+    if (diagInputs.contains("stride"))
+        selection.stride = diagInputs["stride"].template to<int>();
+    if (diagInputs.contains("fraction"))
+        selection.fraction = diagInputs["fraction"].template to<double>();
+    if (diagInputs.contains("seed"))
+        selection.seed = diagInputs["seed"].template to<std::size_t>();
+
     return *this;
 }
 
@@ -146,9 +195,15 @@ void DiagnosticsManager<Writer>::dump_level(std::size_t level, double timeStamp)
 }
 
 
+/*
+ * all ranks have the same timestamps, so they all skip the writer on steps without output,
+ * which then costs no communication
+ */
 template<typename Writer>
 void DiagnosticsManager<Writer>::dump(double timeStamp, double timeStep)
 {
+    PHARE_TIMER_SCOPE("dump");
+
     std::vector<DiagnosticProperties*> activeDiagnostics;
     for (auto& diag : diagnostics_)
     {
@@ -164,6 +219,9 @@ void DiagnosticsManager<Writer>::dump(double timeStamp, double timeStep)
             activeDiagnostics.emplace_back(&diag);
         }
     }
+    if (activeDiagnostics.empty())
+        return;
+
     writer_->dump(activeDiagnostics, timeStamp);
 
     for (auto const* diag : activeDiagnostics)
@@ -49,6 +49,8 @@ public:
 
     auto& getIons() const { return model_.state.ions; }
 
+    auto& getCurrent() const { return model_.state.J; }
+
 
     template<typename Action, typename... Args>
     void visitHierarchy(Action&& action, int minLevel = 0, int maxLevel = 0)
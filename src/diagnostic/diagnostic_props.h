@@ -2,16 +2,53 @@
 #define DIAGNOSTIC_DAO_H
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
 
 namespace PHARE::diagnostic
 {
+// how the datasets of a diagnostic are stored, each option is disabled by its default value
+struct DatasetOptions
+{
+    std::size_t chunkSize = 0; // in number of elements, automatic if 0 and a filter is used
+    std::size_t gzipLevel = 0; // deflate compression level, from 1 to 9
+    bool shuffle          = false; // byte shuffle before compression, improves its ratio
+
+    // lossy, number of mantissa bits kept for floating point values, the rest is zeroed so that
+    // it compresses well (e.g. 10 for half precision accuracy, with single precision range)
+    std::size_t mantissaBits = 0;
+    std::vector<std::string> quantizedDatasets; // datasets mantissaBits applies to, none if empty
+};
+
+
+// binning of the histograms of reduced diagnostics
+struct HistogramOptions
+{
+    std::vector<std::string> axes;    // among x, y, z, vx, vy, vz
+    std::vector<std::size_t> nbrBins; // per axis
+    std::vector<double> ranges;       // lower and upper bound of each axis
+};
+
+
+// particles a particle diagnostic writes, all of them by default
+struct ParticleSelectionOptions
+{
+    std::vector<double> box; // lower and upper coordinates of each direction, no box if empty
+    std::size_t stride = 1;  // keeps one particle in stride, in the order of each patch
+    double fraction    = 1.; // random fraction of the particles kept
+    std::uint64_t seed = 0;  // of the random selection
+};
+
+
 struct DiagnosticProperties
 {
     std::vector<double> writeTimestamps, computeTimestamps;
     std::string type, quantity;
+    DatasetOptions datasetOptions;
+    HistogramOptions histogram;
+    ParticleSelectionOptions selection;
 };
 
 } // namespace PHARE::diagnostic
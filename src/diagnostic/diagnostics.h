@@ -9,6 +9,7 @@
 #endif
 
 #include "diagnostic_manager.h"
+#include "checkpoint_manager.h"
 
 #include "cppdict/include/dict.hpp"
 
@@ -17,9 +18,11 @@
 #include "diagnostic_model_view.h"
 
 #include "diagnostic/detail/h5writer.h"
+#include "diagnostic/detail/h5_checkpoint.h"
 #include "diagnostic/detail/types/electromag.h"
 #include "diagnostic/detail/types/particle.h"
 #include "diagnostic/detail/types/fluid.h"
+#include "diagnostic/detail/types/reduced.h"
 
 #endif
 
@@ -38,6 +41,16 @@ struct NullOpDiagnosticsManager : public IDiagnosticsManager
     }
 };
 
+struct NullOpCheckpointManager : public ICheckpointManager
+{
+    void dump(double /*timeStamp*/, double /*timeStep*/, std::size_t /*step*/) override
+    {
+        throw std::runtime_error("NOOP");
+    }
+
+    void load(int /*levelNumber*/) override { throw std::runtime_error("NOOP"); }
+};
+
 struct DiagnosticsManagerResolver
 {
     template<typename Hierarchy, typename Model>
@@ -54,6 +67,22 @@ struct DiagnosticsManagerResolver
     }
 };
 
+struct CheckpointManagerResolver
+{
+    template<typename Hierarchy, typename Model>
+    static std::unique_ptr<ICheckpointManager> make_unique(Hierarchy& hier, Model& model,
+                                                           initializer::PHAREDict& dict)
+    {
+#if PHARE_HAS_HIGHFIVE
+        using ModelView_t  = ModelView<Hierarchy, Model>;
+        using Checkpoint_t = h5::Checkpoint<ModelView_t>;
+        return CheckpointManager<Checkpoint_t>::make_unique(hier, model, dict);
+#else
+        return std::make_unique<NullOpCheckpointManager>();
+#endif
+    }
+};
+
 } // namespace PHARE::diagnostic
 
 #endif // DIAGNOSTIC_DIAGNOSTICS_H
@@ -0,0 +1,100 @@
+#ifndef PHARE_DIAGNOSTIC_PARTICLE_SELECTION_H
+#define PHARE_DIAGNOSTIC_PARTICLE_SELECTION_H
+
+#include "diagnostic_props.h"
+#include "core/utilities/counter_rng.h"
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace PHARE::diagnostic
+{
+inline bool selectsAll(ParticleSelectionOptions const& options)
+{
+    return options.box.empty() and options.stride <= 1 and options.fraction >= 1.;
+}
+
+
+/*
+ * random draw in [0, 1) for a particle, the seed being hashed with the particle cell, delta and
+ * velocity. The draw does not depend on the order of the particles nor on the domain
+ * decomposition, and is the same for all the visits of a dump.
+ */
+template<typename Particle>
+double particleDraw(Particle const& particle, std::uint64_t seed)
+{
+    std::uint64_t hash = core::splitMix64(seed);
+    auto combine       = [&](auto const value) {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(value));
+        hash = core::splitMix64(hash ^ bits);
+    };
+
+    for (auto const iCell : particle.iCell)
+        combine(iCell);
+    for (auto const delta : particle.delta)
+        combine(delta);
+    for (auto const v : particle.v)
+        combine(v);
+
+    return static_cast<double>(hash >> 11) * 0x1.0p-53;
+}
+
+
+/*
+ * fills selected with the indexes of the particles of a patch the options select, in order.
+ * A particle is selected if it is in the box, then one in stride of those, then with probability
+ * fraction. Nothing is copied, particles are only read.
+ */
+template<typename Particles, typename GridLayout>
+void selectParticles(ParticleSelectionOptions const& options, Particles const& particles,
+                     GridLayout const& layout, std::vector<std::size_t>& selected)
+{
+    constexpr auto dimension = GridLayout::dimension;
+
+    selected.clear();
+
+    auto const& origin   = layout.origin();
+    auto const& meshSize = layout.meshSize();
+    auto const& AMRBox   = layout.AMRBox();
+    auto const& box      = options.box;
+
+    if (!box.empty())
+        for (std::size_t i = 0; i < dimension; ++i)
+        {
+            auto const nbrCells   = AMRBox.upper[i] - AMRBox.lower[i] + 1;
+            auto const patchUpper = origin[i] + nbrCells * meshSize[i];
+            if (box[2 * i] >= patchUpper or box[2 * i + 1] <= origin[i])
+                return; // the patch does not intersect the box
+        }
+
+    auto inBox = [&](auto const& particle) {
+        for (std::size_t i = 0; i < dimension; ++i)
+        {
+            auto const cell     = particle.iCell[i] - AMRBox.lower[i];
+            auto const position = origin[i] + (cell + double{particle.delta[i]}) * meshSize[i];
+            if (position < box[2 * i] or position >= box[2 * i + 1])
+                return false;
+        }
+        return true;
+    };
+
+    std::size_t nbrInBox = 0;
+    for (std::size_t index = 0; index < particles.size(); ++index)
+    {
+        auto const& particle = particles[index];
+        if (!box.empty() and !inBox(particle))
+            continue;
+        if (options.stride > 1 and nbrInBox++ % options.stride != 0)
+            continue;
+        if (options.fraction < 1. and particleDraw(particle, options.seed) >= options.fraction)
+            continue;
+        selected.push_back(index);
+    }
+}
+
+} // namespace PHARE::diagnostic
+
+#endif /* PHARE_DIAGNOSTIC_PARTICLE_SELECTION_H */
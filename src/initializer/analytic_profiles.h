@@ -0,0 +1,90 @@
+#ifndef PHARE_INITIALIZER_ANALYTIC_PROFILES_H
+#define PHARE_INITIALIZER_ANALYTIC_PROFILES_H
+
+#include "initializer/data_provider.h"
+
+#include <map>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+namespace PHARE
+{
+namespace initializer
+{
+    using ProfileParameters = std::map<std::string, double>;
+
+
+    /**
+     * @brief makeAnalyticProfile returns an init function evaluating a named analytic profile in
+     * C++, so that it is evaluated without calling the interpreter, nor holding the GIL.
+     *
+     * Profiles vary along one direction, given by the "axis" parameter (0 for x, 1 for y and 2
+     * for z, default 0):
+     *
+     * uniform : value
+     * tanh    : background + amplitude * tanh((x - center) / width)
+     * harris  : background + amplitude / cosh^2((x - center) / width)
+     *
+     * Parameters default to 0, except width and amplitude that default to 1.
+     */
+    template<std::size_t dim>
+    InitFunction<dim> makeAnalyticProfile(std::string const& name,
+                                          ProfileParameters const& parameters)
+    {
+        auto parameter = [&](std::string const& key, double defaultValue) {
+            auto it = parameters.find(key);
+            return it == parameters.end() ? defaultValue : it->second;
+        };
+
+        auto const axis       = static_cast<std::size_t>(parameter("axis", 0));
+        auto const value      = parameter("value", 0);
+        auto const background = parameter("background", 0);
+        auto const amplitude  = parameter("amplitude", 1);
+        auto const center     = parameter("center", 0);
+        auto const width      = parameter("width", 1);
+
+        if (axis >= dim)
+            throw std::runtime_error("Error: analytic profile axis is not a simulation direction");
+        if (width <= 0)
+            throw std::runtime_error("Error: analytic profile width must be positive");
+
+        // evaluates profile on the coordinates along the axis of the profile
+        auto makeInitFunction = [axis](auto&& profile) -> InitFunction<dim> {
+            return [axis, profile](auto const&... coords) {
+                std::array<std::vector<double> const*, dim> const xyz{&coords...};
+                auto const& x = *xyz[axis];
+
+                std::vector<double> values(x.size());
+                for (std::size_t i = 0; i < x.size(); ++i)
+                    values[i] = profile(x[i]);
+                return std::make_shared<core::VectorSpan<double>>(std::move(values));
+            };
+        };
+
+        if (name == "uniform")
+            return makeInitFunction([value](double) { return value; });
+
+        if (name == "tanh")
+            return makeInitFunction([=](double x) {
+                return background + amplitude * std::tanh((x - center) / width);
+            });
+
+        if (name == "harris")
+            return makeInitFunction([=](double x) {
+                auto const cosh = std::cosh((x - center) / width);
+                return background + amplitude / (cosh * cosh);
+            });
+
+        throw std::runtime_error("Error: unknown analytic profile " + name);
+    }
+
+} // namespace initializer
+
+} // namespace PHARE
+
+#endif // PHARE_INITIALIZER_ANALYTIC_PROFILES_H
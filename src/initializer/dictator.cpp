@@ -1,5 +1,6 @@
 
 #include "cppdict/include/dict.hpp"
+#include "initializer/analytic_profiles.h"
 #include "initializer/python_data_provider.h"
 
 #include "python3/pybind_def.h"
@@ -38,6 +39,13 @@ void add_optional_size_t(std::string path, std::optional<std::size_t>&& value)
                  PHARE::initializer::PHAREDictHandler::INSTANCE().dict());
 }
 
+template<std::size_t dim>
+void add_profile(std::string path, std::string name,
+                 PHARE::initializer::ProfileParameters parameters)
+{
+    add(path, PHARE::initializer::makeAnalyticProfile<dim>(name, parameters));
+}
+
 template<typename T>
 void add_array_as_vector(std::string path, PHARE::pydata::py_array_t<T>& array)
 {
@@ -66,5 +74,9 @@ PYBIND11_MODULE(dictator, m)
     m.def("addInitFunction2D", add<InitFunction<2>>, "add");
     m.def("addInitFunction3D", add<InitFunction<3>>, "add");
 
+    m.def("addProfile1D", add_profile<1>, "add_profile");
+    m.def("addProfile2D", add_profile<2>, "add_profile");
+    m.def("addProfile3D", add_profile<3>, "add_profile");
+
     m.def("add_array_as_vector", add_array_as_vector<double>, "add_array_as_vector");
 }
@@ -3,23 +3,122 @@
 
 #include "initializer/data_provider.h"
 
+#include <cmath>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+#include <cstddef>
+#include <stdexcept>
 
+#if defined(PHARE_HAS_HIGHFIVE) && PHARE_HAS_HIGHFIVE
+#include "highfive/H5File.hpp"
+#endif
 
 namespace PHARE
 {
 namespace initializer
 {
+    // name of the checkpoint file written at the given time in the directory dir, the time
+    // being rounded to 10 decimals so that it does not depend on the rounding errors of time
+    inline std::string restartFilePath(std::string const& dir, double time)
+    {
+        std::stringstream ss;
+        ss << dir << "/checkpoint_" << std::fixed << std::setprecision(10) << time << ".h5";
+        return ss.str();
+    }
+
+
+
+    /**
+     * @brief RestartDataProvider completes the simulation dict of a simulation restarting from
+     * the checkpoint written at simulation/restarts/restart_time, in simulation/restarts/filePath.
+     * Checkpoints being written at the time step closest to their scheduled time, and named after
+     * it, the file read is the one of the time step closest to restart_time.
+     *
+     * It sets in simulation/restarts the path of the checkpoint to load (loadPath), and the
+     * time and step the simulation restarts from. The refinement boxes of the checkpoint are
+     * set in simulation/AMR/refinement/boxes, so that the hierarchy is rebuilt with the levels
+     * of the checkpoint, whatever the number of MPI ranks.
+     */
     class RestartDataProvider : public DataProvider
     {
     public:
-        virtual void read() override
+        RestartDataProvider()
+            : dict_{PHAREDictHandler::INSTANCE().dict()}
+        {
+        }
+
+        RestartDataProvider(PHAREDict& dict)
+            : dict_{dict}
+        {
+        }
+
+        void read() override
         {
-            // read in python script
+#if defined(PHARE_HAS_HIGHFIVE) && PHARE_HAS_HIGHFIVE
+            auto& simulation = dict_["simulation"];
+            auto& restarts   = simulation["restarts"];
+            auto const dt    = simulation["time_step"].template to<double>();
+            auto const step  = std::round(restarts["restart_time"].template to<double>() / dt);
+            auto const path
+                = restartFilePath(restarts["filePath"].template to<std::string>(), step * dt);
+
+            // each rank only reads the small tables of the patch boxes
+            HighFive::File h5{path, HighFive::File::ReadOnly};
+
+            double time                = 0;
+            std::size_t checkpointStep = 0;
+            std::size_t nbrLevels      = 0;
+            h5.getAttribute("time").read(time);
+            h5.getAttribute("step").read(checkpointStep);
+            h5.getAttribute("nbrLevels").read(nbrLevels);
+
+            restarts["loadPath"] = path;
+            restarts["time"]     = time;
+            restarts["step"]     = static_cast<int>(checkpointStep);
+
+            auto const dimension = simulation["dimension"].template to<int>();
+            auto& boxes          = simulation["AMR"]["refinement"]["boxes"];
+            boxes["nbr_levels"]  = static_cast<int>(nbrLevels - 1);
+
+            std::string const axes = "xyz";
+            for (std::size_t iLevel = 1; iLevel < nbrLevels; ++iLevel)
+            {
+                auto const levelPath = "/pl" + std::to_string(iLevel) + "/patches/";
+                std::vector<int> lower, upper;
+                h5.getDataSet(levelPath + "lower").read(lower);
+                h5.getDataSet(levelPath + "upper").read(upper);
+
+                // patches of level i, coarsened, are the refinement boxes of level i - 1
+                auto& levelDict   = boxes["L" + std::to_string(iLevel - 1)];
+                auto const nbrBox = static_cast<int>(lower.size()) / dimension;
+                levelDict["nbr_boxes"] = nbrBox;
+                for (int iBox = 0; iBox < nbrBox; ++iBox)
+                {
+                    auto& boxDict = levelDict["B" + std::to_string(iBox)];
+                    for (int i = 0; i < dimension; ++i)
+                    {
+                        auto const axis = std::string{axes[i]};
+                        boxDict["lower"][axis] = coarsen_(lower[iBox * dimension + i]);
+                        boxDict["upper"][axis] = coarsen_(upper[iBox * dimension + i]);
+                    }
+                }
+            }
+#else
+            throw std::runtime_error("Error: restarting a simulation requires HighFive");
+#endif
         }
+
+    private:
+        // refinement ratio is 2 between all levels
+        static int coarsen_(int index) { return index >= 0 ? index / 2 : (index - 1) / 2; }
+
+        PHAREDict& dict_;
     };
 
 } // namespace initializer
 
 } // namespace PHARE
 
-#endif // DATA_PROVIDER_H
+#endif // PHARE_RESTART_DATA_PROVIDER_H
@@ -0,0 +1,212 @@
+#ifndef PHARE_SERIALIZED_DATA_PROVIDER_H
+#define PHARE_SERIALIZED_DATA_PROVIDER_H
+
+#include "initializer/data_provider.h"
+#include "initializer/analytic_profiles.h"
+#include "core/utilities/mpi_utils.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <optional>
+#include <stdexcept>
+
+namespace PHARE
+{
+namespace initializer
+{
+    /**
+     * @brief SerializedDataProvider fills the simulation dict from a file written once by
+     * pyphare.pharein.serialize, without starting the python interpreter. Rank 0 reads the file
+     * and broadcasts it to the other ranks.
+     *
+     * The file starts with "PHAREDICT" and a format version (uint32), followed by the entries
+     * added to the dict, in the order pyphare added them. An entry is its type (uint8), its path
+     * and its value. Strings are a uint32 size followed by their characters, and numbers are
+     * little endian. Init functions can only be analytic profiles, stored as their dimension
+     * (uint8), name, number of parameters (uint32) and (name, value) of each parameter.
+     */
+    class SerializedDataProvider : public DataProvider
+    {
+    public:
+        enum class Entry : std::uint8_t {
+            Int = 0,
+            Double,
+            String,
+            SizeT,
+            OptionalSizeT,
+            VectorDouble,
+            Profile
+        };
+
+        static constexpr char const* magic    = "PHAREDICT";
+        static constexpr std::uint32_t version = 1;
+
+
+        SerializedDataProvider(std::string path)
+            : path_{path}
+            , dict_{PHAREDictHandler::INSTANCE().dict()}
+        {
+        }
+
+        SerializedDataProvider(std::string path, PHAREDict& dict)
+            : path_{path}
+            , dict_{dict}
+        {
+        }
+
+
+        void read() override
+        {
+            // an error reading the file on rank 0 is thrown on all ranks, which would otherwise
+            // wait for the broadcast of the file forever
+            std::string bytes, error;
+            if (core::mpi::rank() == 0)
+            {
+                try
+                {
+                    bytes = readFile_();
+                }
+                catch (std::exception const& e)
+                {
+                    error = e.what();
+                }
+            }
+            error = core::mpi::broadcast(error);
+            if (!error.empty())
+                throw std::runtime_error(error);
+
+            Reader reader{core::mpi::broadcast(bytes)};
+
+            if (reader.bytes(std::strlen(magic)) != magic or reader.get<std::uint32_t>() != version)
+                throw std::runtime_error("Error: " + path_ + " is not a serialized PHARE dict");
+
+            while (!reader.done())
+                readEntry_(reader);
+        }
+
+
+    private:
+        class Reader
+        {
+        public:
+            Reader(std::string&& bytes)
+                : bytes_{std::move(bytes)}
+            {
+            }
+
+            bool done() const { return position_ == bytes_.size(); }
+
+            template<typename Type>
+            Type get()
+            {
+                Type value;
+                std::memcpy(&value, next_(sizeof(Type)), sizeof(Type));
+                return value;
+            }
+
+            std::string bytes(std::size_t size) { return std::string{next_(size), size}; }
+
+            std::string string() { return bytes(get<std::uint32_t>()); }
+
+        private:
+            char const* next_(std::size_t size)
+            {
+                if (position_ + size > bytes_.size())
+                    throw std::runtime_error("Error: truncated serialized PHARE dict");
+                auto const* data = bytes_.data() + position_;
+                position_ += size;
+                return data;
+            }
+
+            std::string const bytes_;
+            std::size_t position_ = 0;
+        };
+
+
+        std::string readFile_() const
+        {
+            std::ifstream file{path_, std::ios::binary};
+            if (!file)
+                throw std::runtime_error("Error: cannot open " + path_);
+            std::stringstream ss;
+            ss << file.rdbuf();
+            return ss.str();
+        }
+
+
+        void readEntry_(Reader& reader)
+        {
+            auto const entry = static_cast<Entry>(reader.get<std::uint8_t>());
+            auto const path  = reader.string();
+
+            switch (entry)
+            {
+                case Entry::Int:
+                    cppdict::add(path, static_cast<int>(reader.get<std::int64_t>()), dict_);
+                    break;
+                case Entry::Double: cppdict::add(path, reader.get<double>(), dict_); break;
+                case Entry::String: cppdict::add(path, reader.string(), dict_); break;
+                case Entry::SizeT:
+                    cppdict::add(path, std::size_t{reader.get<std::uint64_t>()}, dict_);
+                    break;
+                case Entry::OptionalSizeT:
+                {
+                    std::optional<std::size_t> value;
+                    auto const hasValue = reader.get<std::uint8_t>();
+                    auto const bits     = reader.get<std::uint64_t>();
+                    if (hasValue)
+                        value = bits;
+                    cppdict::add(path, value, dict_);
+                    break;
+                }
+                case Entry::VectorDouble:
+                {
+                    std::vector<double> values(reader.get<std::uint64_t>());
+                    for (auto& value : values)
+                        value = reader.get<double>();
+                    cppdict::add(path, std::move(values), dict_);
+                    break;
+                }
+                case Entry::Profile: readProfile_(reader, path); break;
+                default: throw std::runtime_error("Error: unknown serialized dict entry " + path);
+            }
+        }
+
+
+        void readProfile_(Reader& reader, std::string const& path)
+        {
+            auto const dimension = reader.get<std::uint8_t>();
+            auto const name      = reader.string();
+
+            ProfileParameters parameters;
+            auto const nbrParameters = reader.get<std::uint32_t>();
+            for (std::uint32_t i = 0; i < nbrParameters; ++i)
+            {
+                auto key        = reader.string();
+                parameters[key] = reader.get<double>();
+            }
+
+            if (dimension == 1)
+                cppdict::add(path, makeAnalyticProfile<1>(name, parameters), dict_);
+            else if (dimension == 2)
+                cppdict::add(path, makeAnalyticProfile<2>(name, parameters), dict_);
+            else if (dimension == 3)
+                cppdict::add(path, makeAnalyticProfile<3>(name, parameters), dict_);
+            else
+                throw std::runtime_error("Error: invalid profile dimension for " + path);
+        }
+
+
+        std::string path_;
+        PHAREDict& dict_;
+    };
+
+} // namespace initializer
+
+} // namespace PHARE
+
+#endif // PHARE_SERIALIZED_DATA_PROVIDER_H
@@ -3,6 +3,7 @@
 #include "phare/phare.h"
 #include "simulator/simulator.h"
 #include "amr/wrappers/hierarchy.h"
+#include "initializer/serialized_data_provider.h"
 #include "initializer/python_data_provider.h"
 
 std::unique_ptr<PHARE::initializer::DataProvider> fromCommandLine(int argc, char** argv)
@@ -20,6 +21,11 @@ std::unique_ptr<PHARE::initializer::DataProvider> fromCommandLine(int argc, char
                 std::cout << "python input detected, building with python provider...\n";
                 return std::make_unique<PHARE::initializer::PythonDataProvider>(moduleName);
             }
+            if (arg.substr(arg.find_last_of(".") + 1) == "phd")
+            {
+                std::cout << "serialized input detected, building with serialized provider...\n";
+                return std::make_unique<PHARE::initializer::SerializedDataProvider>(arg);
+            }
 
             break;
     }
@@ -63,8 +69,10 @@ int main(int argc, char** argv)
     {
         simulator->dump(simulator->currentTime(), simulator->timeStep());
         simulator->advance(simulator->timeStep());
-        std::cout << simulator->currentTime() << "\n";
+        if (PHARE::core::mpi::rank() == 0)
+            std::cout << simulator->currentTime() << "\n";
         //    time += simulator.timeStep();
     }
+    simulator->flush();
     PHARE::initializer::PHAREDictHandler::INSTANCE().stop();
 }
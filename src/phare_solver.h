@@ -9,6 +9,8 @@
 #include "solver/solvers/solver_ppc.h"
 #include "solver/level_initializer/level_initializer.h"
 #include "solver/level_initializer/level_initializer_factory.h"
+#include "solver/tagging/tagger.h"
+#include "solver/tagging/tagger_factory.h"
 #include "solver/multiphysics_integrator.h"
 #include "solver/physical_models/hybrid_model.h"
 #include "solver/physical_models/mhd_model.h"
@@ -39,6 +41,7 @@ struct PHARE_Types
     using SolverPPC_t = PHARE::solver::SolverPPC<HybridModel_t, PHARE::amr::SAMRAI_Types>;
     using SolverMHD_t = PHARE::solver::SolverMHD<MHDModel_t, PHARE::amr::SAMRAI_Types>;
     using LevelInitializerFactory_t = PHARE::solver::LevelInitializerFactory<HybridModel_t>;
+    using TaggerFactory_t           = PHARE::solver::TaggerFactory<HybridModel_t>;
 
     // amr deps
     using amr_types        = PHARE::amr::PHARE_Types<dimension, interp_order, nbRefinedPart>;
@@ -50,7 +53,7 @@ struct PHARE_Types
 
     using MultiPhysicsIntegrator
         = PHARE::solver::MultiPhysicsIntegrator<MessengerFactory, LevelInitializerFactory_t,
-                                                PHARE::amr::SAMRAI_Types>;
+                                                TaggerFactory_t, PHARE::amr::SAMRAI_Types>;
 };
 
 } // namespace PHARE::solver
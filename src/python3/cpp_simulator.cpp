@@ -58,6 +58,9 @@ void declareDim(py::module& m)
 
     name = "PatchData" + name;
     declarePatchData<CP, dim>(m, name.c_str());
+
+    name = "PatchDataParticleArray_" + std::to_string(dim);
+    declarePatchData<py::array, dim>(m, name.c_str());
 }
 
 template<typename Simulator, typename PyClass>
@@ -72,7 +75,8 @@ void declareSimulator(PyClass&& sim)
         .def("to_str", &Simulator::to_str)
         .def("domain_box", &Simulator::domainBox)
         .def("cell_width", &Simulator::cellWidth)
-        .def("dump", &Simulator::dump, py::arg("timestamp"), py::arg("timestep"));
+        .def("dump", &Simulator::dump, py::arg("timestamp"), py::arg("timestep"))
+        .def("flush", &Simulator::flush);
 }
 
 template<typename _dim, typename _interp, typename _nbRefinedPart>
@@ -108,7 +112,9 @@ void declare(py::module& m)
     py::class_<DW, std::shared_ptr<DW>>(m, name.c_str())
         .def(py::init<std::shared_ptr<Sim> const&, std::shared_ptr<amr::Hierarchy> const&>())
         .def(py::init<std::shared_ptr<ISimulator> const&, std::shared_ptr<amr::Hierarchy> const&>())
-        .def("sync_merge", &DW::sync_merge)
+        .def("sync", &DW::sync, py::arg("input"), py::arg("root_only") = false)
+        .def("sync_merge", &DW::sync_merge, py::arg("input"), py::arg("primal"),
+             py::arg("root_only") = false)
         .def("getPatchLevel", &DW::getPatchLevel)
         .def("getNumberOfLevels", &DW::getNumberOfLevels);
 
@@ -135,7 +141,9 @@ void declare(py::module& m)
         .def("getFx", &PL::getFx)
         .def("getFy", &PL::getFy)
         .def("getFz", &PL::getFz)
-        .def("getParticles", &PL::getParticles, py::arg("userPopName") = "all");
+        .def("getParticles", &PL::getParticles, py::arg("userPopName") = "all")
+        .def("getParticleArrays", &PL::getParticleArrays, py::arg("popName"),
+             py::arg("lower") = std::vector<int>{}, py::arg("upper") = std::vector<int>{});
 
     using _Splitter
         = PHARE::amr::Splitter<_dim, _interp, core::RefinedParticlesConst<nbRefinedPart>>;
@@ -170,7 +178,8 @@ PYBIND11_MODULE(cpp, m)
     declareSimulator<ISimulator>(
         py::class_<ISimulator, std::shared_ptr<ISimulator>>(m, "ISimulator")
             .def("interp_order", &ISimulator::interporder)
-            .def("dump", &ISimulator::dump, py::arg("timestamp"), py::arg("timestep")));
+            .def("dump", &ISimulator::dump, py::arg("timestamp"), py::arg("timestep"))
+            .def("flush", &ISimulator::flush));
 
     m.def("make_hierarchy", []() { return PHARE::amr::Hierarchy::make(); });
     m.def("make_simulator", [](std::shared_ptr<PHARE::amr::Hierarchy>& hier) {
@@ -194,9 +203,9 @@ PYBIND11_MODULE(cpp, m)
 
     core::apply(core::possibleSimulators(), [&](auto const& simType) { declare(m, simType); });
 
-    declarePatchData<std::vector<double>, 1>(m, "PatchDataVectorDouble_1D");
-    declarePatchData<std::vector<double>, 2>(m, "PatchDataVectorDouble_2D");
-    declarePatchData<std::vector<double>, 3>(m, "PatchDataVectorDouble_3D");
+    declarePatchData<py_array_t<double>, 1>(m, "PatchDataPyArrayDouble_1D");
+    declarePatchData<py_array_t<double>, 2>(m, "PatchDataPyArrayDouble_2D");
+    declarePatchData<py_array_t<double>, 3>(m, "PatchDataPyArrayDouble_3D");
 
     py::class_<core::Span<double>, std::shared_ptr<core::Span<double>>>(m, "Span");
     py::class_<PyArrayWrapper<double>, std::shared_ptr<PyArrayWrapper<double>>, core::Span<double>>(
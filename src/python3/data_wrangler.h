@@ -5,9 +5,11 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <vector>
 #include "amr/wrappers/hierarchy.h"
 #include "core/utilities/meta/meta_utilities.h"
@@ -85,10 +87,10 @@ public:
             *hierarchy_, *simulator_.getHybridModel(), lvl};
     }
 
-    auto sort_merge_1d(std::vector<PatchData<std::vector<double>, dimension>> const&& input,
+    auto sort_merge_1d(std::vector<FieldPatchData<dimension>> const&& input,
                        bool shared_patch_border = false)
     {
-        std::vector<std::pair<double, const PatchData<std::vector<double>, dimension>*>> sorted;
+        std::vector<std::pair<double, FieldPatchData<dimension> const*>> sorted;
         for (auto const& data : input)
             sorted.emplace_back(core::Point<double, 1>::fromString(data.origin)[0], &data);
         std::sort(sorted.begin(), sorted.end(), [](auto& a, auto& b) { return a.first < b.first; });
@@ -97,63 +99,40 @@ public:
         { // skip empty patches in case of unequal patches across MPI domains
             if (!sorted[i].second->data.size())
                 continue;
-            auto& data   = sorted[i].second->data;
+            auto data    = makeSpan(sorted[i].second->data);
             auto& ghosts = sorted[i].second->nGhosts;
             auto end     = ghosts;
             // primal nodes share a cell wall when patches touch so drop duplicate value if so
             if (shared_patch_border)
                 end = i == sorted.size() - 1 ? end : end + 1;
-            ret.insert(std::end(ret), std::begin(data) + ghosts, std::end(data) - end);
+            ret.insert(std::end(ret), data.data() + ghosts, data.data() + data.size() - end);
         }
         return ret;
     }
 
-    auto sync(std::vector<PatchData<std::vector<double>, dimension>> const& input)
+    /*
+     * returns the patch datas of input of all ranks, on all ranks, or only on rank 0 if rootOnly,
+     * in which case the other ranks get none
+     */
+    auto sync(std::vector<FieldPatchData<dimension>> const& input, bool rootOnly = false)
     {
-        int mpi_size = core::mpi::size();
-        std::vector<PatchData<std::vector<double>, dimension>> collected;
+        auto const packed  = pack_(input);
+        auto const perRank = rootOnly ? core::mpi::gather(packed) : core::mpi::collect(packed);
 
-        auto reinterpret_array = [&](auto& py_array) {
-            return reinterpret_cast<std::array<std::size_t, dimension>&>(
-                *static_cast<std::size_t*>(py_array.request().ptr));
-        };
-
-        auto collect = [&](PatchData<std::vector<double>, dimension> const& patch_data) {
-            auto patchIDs = core::mpi::collect(patch_data.patchID, mpi_size);
-            auto origins  = core::mpi::collect(patch_data.origin, mpi_size);
-            auto lower    = core::mpi::collect_raw(makeSpan(patch_data.lower), mpi_size);
-            auto upper    = core::mpi::collect_raw(makeSpan(patch_data.upper), mpi_size);
-            auto ghosts   = core::mpi::collect(patch_data.nGhosts, mpi_size);
-            auto datas    = core::mpi::collect(patch_data.data, mpi_size);
-
-            for (int i = 0; i < mpi_size; i++)
-            {
-                auto& data = collected.emplace_back();
-                setPatchData(data, patchIDs[i], origins[i], lower[i], upper[i]);
-                data.nGhosts = ghosts[i];
-                data.data    = std::move(datas[i]);
-            }
-        };
-
-        std::size_t max = core::mpi::max(input.size(), mpi_size);
-
-        PatchData<std::vector<double>, dimension> empty;
-
-        for (size_t i = 0; i < max; i++)
-        {
-            if (i < input.size())
-                collect(input[i]);
-            else
-                collect(empty);
-        }
+        std::vector<FieldPatchData<dimension>> collected;
+        for (auto const& bytes : perRank)
+            unpack_(bytes, collected);
         return collected;
     }
 
-    auto sync_merge(std::vector<PatchData<std::vector<double>, dimension>> const& input,
-                    [[maybe_unused]] bool primal)
+    py_array_t<double> sync_merge(std::vector<FieldPatchData<dimension>> const& input,
+                                  [[maybe_unused]] bool primal, bool rootOnly = false)
     {
         if constexpr (dimension == 1)
-            return sort_merge_1d(sync(input), primal);
+        {
+            auto merged = sort_merge_1d(sync(input, rootOnly), primal);
+            return py_array_t<double>(merged.size(), merged.data());
+        }
 
         throw std::runtime_error("Not handled for >1 dim");
     }
@@ -179,6 +158,72 @@ private:
 
         return *simulator_ptr;
     }
+
+
+    // the patch datas of input as bytes, for the other ranks
+    static std::string pack_(std::vector<FieldPatchData<dimension>> const& input)
+    {
+        std::string bytes;
+        auto write = [&](auto const* data, std::size_t size) {
+            bytes.append(reinterpret_cast<char const*>(data), size * sizeof(*data));
+        };
+        auto writeString = [&](std::string const& string) {
+            std::size_t const size = string.size();
+            write(&size, 1);
+            write(string.data(), size);
+        };
+
+        for (auto const& patchData : input)
+        {
+            auto const& data       = patchData.data;
+            std::size_t const ndim = data.ndim();
+            writeString(patchData.patchID);
+            writeString(patchData.origin);
+            write(patchData.lower.data(), dimension);
+            write(patchData.upper.data(), dimension);
+            write(&patchData.nGhosts, 1);
+            write(&ndim, 1);
+            write(data.shape(), ndim);
+            write(data.data(), data.size());
+        }
+        return bytes;
+    }
+
+
+    // appends the patch datas packed in bytes to patchDatas, their data being copies
+    static void unpack_(std::string const& bytes,
+                        std::vector<FieldPatchData<dimension>>& patchDatas)
+    {
+        std::size_t position = 0;
+        auto read = [&](auto* data, std::size_t size) {
+            std::memcpy(data, bytes.data() + position, size * sizeof(*data));
+            position += size * sizeof(*data);
+        };
+        auto readString = [&]() {
+            std::size_t size;
+            read(&size, 1);
+            std::string string(size, '\0');
+            read(string.data(), size);
+            return string;
+        };
+
+        while (position < bytes.size())
+        {
+            auto& patchData   = patchDatas.emplace_back();
+            patchData.patchID = readString();
+            patchData.origin  = readString();
+            read(patchData.lower.mutable_data(), dimension);
+            read(patchData.upper.mutable_data(), dimension);
+            read(&patchData.nGhosts, 1);
+
+            std::size_t ndim;
+            read(&ndim, 1);
+            std::vector<pybind11::ssize_t> shape(ndim);
+            read(shape.data(), ndim);
+            patchData.data = py_array_t<double>(shape);
+            read(patchData.data.mutable_data(), patchData.data.size());
+        }
+    }
 };
 } // namespace PHARE::pydata
 
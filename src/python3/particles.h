@@ -3,10 +3,15 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
 #include <tuple>
+#include <vector>
 #include "amr/data/particles/refine/particles_data_split.h"
 #include "core/data/particles/particle_packer.h"
 #include "core/data/particles/particle.h"
+#include "core/utilities/box/box.h"
 #include "core/utilities/types.h"
 
 #include "python3/pybind_def.h"
@@ -80,6 +85,82 @@ pyarray_particles_t splitPyArrayParticles(pyarray_particles_crt const& py_partic
     return particlesOut;
 }
 
+
+
+/*
+ * numpy structured dtype of core::Particle<dim>, so that particle arrays are seen from python
+ * without copy. Its fields are named as the members of Particle, array members of size dim
+ * being scalars in 1D.
+ */
+template<std::size_t dim>
+pybind11::dtype particleDtype()
+{
+    using Particle = core::Particle<dim>;
+
+    pybind11::list names, formats, offsets;
+    auto add = [&](char const* name, std::string const& format, std::size_t size,
+                   std::size_t offset) {
+        names.append(name);
+        formats.append(size == 1 ? format : "(" + std::to_string(size) + ",)" + format);
+        offsets.append(offset);
+    };
+
+    add("weight", "f8", 1, offsetof(Particle, weight));
+    add("charge", "f8", 1, offsetof(Particle, charge));
+    add("iCell", "i4", dim, offsetof(Particle, iCell));
+    add("delta", "f4", dim, offsetof(Particle, delta));
+    add("v", "f8", 3, offsetof(Particle, v));
+    add("Ex", "f8", 1, offsetof(Particle, Ex));
+    add("Ey", "f8", 1, offsetof(Particle, Ey));
+    add("Ez", "f8", 1, offsetof(Particle, Ez));
+    add("Bx", "f8", 1, offsetof(Particle, Bx));
+    add("By", "f8", 1, offsetof(Particle, By));
+    add("Bz", "f8", 1, offsetof(Particle, Bz));
+
+    return pybind11::dtype(names, formats, offsets, sizeof(Particle));
+}
+
+
+/*
+ * read only numpy array over the particles of particles, without copy, which keeps owner alive.
+ * Particle arrays are reallocated as particles move, the array is only valid until the
+ * simulation advances and must be copied (np.array) to be kept, as hierarchy_from_sim does.
+ */
+template<typename ParticleArray, typename Owner>
+pybind11::array makeParticlesView(ParticleArray const& particles,
+                                  std::shared_ptr<Owner> const& owner)
+{
+    using Particle = typename ParticleArray::value_type;
+
+    pybind11::capsule base{new std::shared_ptr<Owner>{owner},
+                           [](void* ptr) { delete static_cast<std::shared_ptr<Owner>*>(ptr); }};
+
+    pybind11::array view{particleDtype<Particle::dimension>(),
+                         {particles.size()},
+                         {sizeof(Particle)},
+                         particles.size() ? &particles[0] : nullptr,
+                         base};
+    view.attr("flags").attr("writeable") = false;
+    return view;
+}
+
+
+// numpy array holding a copy of the particles of particles whose cell is in box
+template<typename ParticleArray, typename Box>
+pybind11::array copyParticlesIn(ParticleArray const& particles, Box const& box)
+{
+    using Particle = typename ParticleArray::value_type;
+
+    std::vector<Particle> selected;
+    for (auto const& particle : particles)
+        if (core::isIn(core::cellAsPoint(particle), box))
+            selected.push_back(particle);
+
+    pybind11::array copy{particleDtype<Particle::dimension>(), {selected.size()}};
+    std::memcpy(copy.mutable_data(), selected.data(), selected.size() * sizeof(Particle));
+    return copy;
+}
+
 } // namespace PHARE::pydata
 
 #endif /*PHARE_PYTHON_PARTICLES_H*/
@@ -2,7 +2,9 @@
 #define PHARE_PYTHON_PATCH_DATA_H
 
 #include <array>
+#include <memory>
 #include <string>
+#include <vector>
 #include <cstring>
 #include <utility>
 
@@ -31,6 +33,11 @@ struct PatchData
 };
 
 
+// field data of a patch, as a numpy array
+template<std::size_t dim>
+using FieldPatchData = PatchData<py_array_t<double>, dim>;
+
+
 template<typename PatchData, typename Container>
 void setPatchData(PatchData& data, std::string const patchID, std::string const origin,
                   Container lower, Container upper)
@@ -50,14 +57,32 @@ void setPatchDataFromGrid(PatchData& pdata, GridLayout& grid, std::string patchI
                  grid.AMRBox().upper.template toArray<std::size_t>());
 }
 
-template<typename PatchData, typename Field, typename GridLayout>
+/*
+ * read only numpy array of the shape of field, over the memory of field, without copy.
+ * The array keeps owner alive, which must own the memory of field. It shows the field as the
+ * simulation advances and must be copied (np.array) to keep the values of a given time.
+ */
+template<typename Field, typename Owner>
+py_array_t<double> makeFieldView(Field const& field, std::shared_ptr<Owner> const& owner)
+{
+    auto const fieldShape = field.shape();
+    std::vector<pybind11::ssize_t> const shape(std::begin(fieldShape), std::end(fieldShape));
+
+    pybind11::capsule base{new std::shared_ptr<Owner>{owner},
+                           [](void* ptr) { delete static_cast<std::shared_ptr<Owner>*>(ptr); }};
+    py_array_t<double> view(shape, field.data(), base);
+    view.attr("flags").attr("writeable") = false;
+    return view;
+}
+
+template<typename PatchData, typename Field, typename GridLayout, typename Owner>
 void setPatchDataFromField(PatchData& pdata, Field const& field, GridLayout& grid,
-                           std::string patchID)
+                           std::string patchID, std::shared_ptr<Owner> const& owner)
 {
     setPatchDataFromGrid(pdata, grid, patchID);
     pdata.nGhosts = static_cast<std::size_t>(
         GridLayout::nbrGhosts(GridLayout::centering(field.physicalQuantity())[0]));
-    pdata.data.assign(field.data(), field.data() + field.size());
+    pdata.data = makeFieldView(field, owner);
 }
 
 
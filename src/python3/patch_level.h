@@ -5,12 +5,22 @@
 #include <cstring>
 #include <cstddef>
 #include <string>
+#include <vector>
 #include <utility>
+#include <stdexcept>
+#include <unordered_map>
 #include "phare_solver.h"
+#include "python3/patch_data.h"
+#include "python3/particles.h"
 
 
 namespace PHARE::pydata
 {
+/*
+ * PatchLevel gives the data of the patches of a level of the simulation.
+ * Fields are read only numpy arrays over the memory of the simulation, not copies: they follow
+ * the simulation as it advances, and keep the memory of the level alive if the level is regridded.
+ */
 template<std::size_t dim, std::size_t interpOrder, std::size_t nbrRefPart>
 class PatchLevel
 {
@@ -28,20 +38,20 @@ public:
         : lvl_(lvl)
         , hierarchy_{hierarchy}
         , model_{model}
+        , level_{hierarchy.getPatchLevel(lvl)}
     {
     }
 
     auto getDensity()
     {
-        std::vector<PatchData<std::vector<double>, dimension>> patchDatas;
+        std::vector<FieldPatchData<dimension>> patchDatas;
         auto& ions = model_.state.ions;
 
         auto visit = [&](GridLayout& grid, std::string patchID, std::size_t /*iLevel*/) {
-            setPatchDataFromField(patchDatas.emplace_back(), ions.density(), grid, patchID);
+            setPatchDataFromField(patchDatas.emplace_back(), ions.density(), grid, patchID, level_);
         };
 
-        PHARE::amr::visitLevel<GridLayout>(*hierarchy_.getPatchLevel(lvl_),
-                                           *model_.resourcesManager, visit, ions);
+        PHARE::amr::visitLevel<GridLayout>(*level_, *model_.resourcesManager, visit, ions);
 
         return patchDatas;
     }
@@ -60,12 +70,11 @@ public:
                     pop_data.emplace(pop.name(), Inner());
 
                 setPatchDataFromField(pop_data.at(pop.name()).emplace_back(), pop.density(), grid,
-                                      patchID);
+                                      patchID, level_);
             }
         };
 
-        PHARE::amr::visitLevel<GridLayout>(*hierarchy_.getPatchLevel(lvl_),
-                                           *model_.resourcesManager, visit, ions);
+        PHARE::amr::visitLevel<GridLayout>(*level_, *model_.resourcesManager, visit, ions);
 
         return pop_data;
     }
@@ -86,7 +95,8 @@ public:
             if (!inner.count(field.name()))
                 inner.emplace(field.name(), decltype(getDensity())());
 
-            setPatchDataFromField(inner.at(field.name()).emplace_back(), field, grid, patchID);
+            setPatchDataFromField(inner.at(field.name()).emplace_back(), field, grid, patchID,
+                                  level_);
         }
     }
 
@@ -104,12 +114,12 @@ public:
                 if (!bulkV.count(field.name()))
                     bulkV.emplace(field.name(), decltype(getDensity())());
 
-                setPatchDataFromField(bulkV.at(field.name()).emplace_back(), field, grid, patchID);
+                setPatchDataFromField(bulkV.at(field.name()).emplace_back(), field, grid, patchID,
+                                      level_);
             }
         };
 
-        PHARE::amr::visitLevel<GridLayout>(*hierarchy_.getPatchLevel(lvl_),
-                                           *model_.resourcesManager, visit, ions);
+        PHARE::amr::visitLevel<GridLayout>(*level_, *model_.resourcesManager, visit, ions);
 
         return bulkV;
     }
@@ -127,8 +137,7 @@ public:
                 getVecFields(pop.flux(), pop_data, grid, patchID, pop.name());
         };
 
-        PHARE::amr::visitLevel<GridLayout>(*hierarchy_.getPatchLevel(lvl_),
-                                           *model_.resourcesManager, visit, ions);
+        PHARE::amr::visitLevel<GridLayout>(*level_, *model_.resourcesManager, visit, ions);
 
         return pop_data;
     }
@@ -148,8 +157,7 @@ public:
             }
         };
 
-        PHARE::amr::visitLevel<GridLayout>(*hierarchy_.getPatchLevel(lvl_),
-                                           *model_.resourcesManager, visit, em);
+        PHARE::amr::visitLevel<GridLayout>(*level_, *model_.resourcesManager, visit, em);
 
         return em_data;
     }
@@ -157,17 +165,17 @@ public:
 
     auto getB(std::string componentName)
     {
-        std::vector<PatchData<std::vector<double>, dimension>> patchDatas;
+        std::vector<FieldPatchData<dimension>> patchDatas;
 
         auto& B = model_.state.electromag.B;
 
         auto visit = [&](GridLayout& grid, std::string patchID, std::size_t /*iLevel*/) {
             auto compo = PHARE::core::Components::componentMap.at(componentName);
-            setPatchDataFromField(patchDatas.emplace_back(), B.getComponent(compo), grid, patchID);
+            setPatchDataFromField(patchDatas.emplace_back(), B.getComponent(compo), grid,
+                                  patchID, level_);
         };
 
-        PHARE::amr::visitLevel<GridLayout>(*hierarchy_.getPatchLevel(lvl_),
-                                           *model_.resourcesManager, visit, B);
+        PHARE::amr::visitLevel<GridLayout>(*level_, *model_.resourcesManager, visit, B);
 
         return patchDatas;
     }
@@ -175,17 +183,17 @@ public:
 
     auto getE(std::string componentName)
     {
-        std::vector<PatchData<std::vector<double>, dimension>> patchDatas;
+        std::vector<FieldPatchData<dimension>> patchDatas;
 
         auto& E = model_.state.electromag.E;
 
         auto visit = [&](GridLayout& grid, std::string patchID, std::size_t /*iLevel*/) {
             auto compo = PHARE::core::Components::componentMap.at(componentName);
-            setPatchDataFromField(patchDatas.emplace_back(), E.getComponent(compo), grid, patchID);
+            setPatchDataFromField(patchDatas.emplace_back(), E.getComponent(compo), grid,
+                                  patchID, level_);
         };
 
-        PHARE::amr::visitLevel<GridLayout>(*hierarchy_.getPatchLevel(lvl_),
-                                           *model_.resourcesManager, visit, E);
+        PHARE::amr::visitLevel<GridLayout>(*level_, *model_.resourcesManager, visit, E);
 
         return patchDatas;
     }
@@ -194,17 +202,17 @@ public:
 
     auto getVi(std::string componentName)
     {
-        std::vector<PatchData<std::vector<double>, dimension>> patchDatas;
+        std::vector<FieldPatchData<dimension>> patchDatas;
 
         auto& V = model_.state.ions.velocity();
 
         auto visit = [&](GridLayout& grid, std::string patchID, std::size_t /*iLevel*/) {
             auto compo = PHARE::core::Components::componentMap.at(componentName);
-            setPatchDataFromField(patchDatas.emplace_back(), V.getComponent(compo), grid, patchID);
+            setPatchDataFromField(patchDatas.emplace_back(), V.getComponent(compo), grid,
+                                  patchID, level_);
         };
 
-        PHARE::amr::visitLevel<GridLayout>(*hierarchy_.getPatchLevel(lvl_),
-                                           *model_.resourcesManager, visit, V);
+        PHARE::amr::visitLevel<GridLayout>(*level_, *model_.resourcesManager, visit, V);
 
         return patchDatas;
     }
@@ -213,7 +221,7 @@ public:
 
     auto getPopFluxCompo(std::string component, std::string popName)
     {
-        std::vector<PatchData<std::vector<double>, dimension>> patchDatas;
+        std::vector<FieldPatchData<dimension>> patchDatas;
 
         auto& ions = model_.state.ions;
 
@@ -222,11 +230,10 @@ public:
             for (auto const& pop : ions)
                 if (pop.name() == popName)
                     setPatchDataFromField(patchDatas.emplace_back(), pop.flux().getComponent(compo),
-                                          grid, patchID);
+                                          grid, patchID, level_);
         };
 
-        PHARE::amr::visitLevel<GridLayout>(*hierarchy_.getPatchLevel(lvl_),
-                                           *model_.resourcesManager, visit, ions);
+        PHARE::amr::visitLevel<GridLayout>(*level_, *model_.resourcesManager, visit, ions);
 
         return patchDatas;
     }
@@ -292,16 +299,69 @@ public:
             }
         };
 
-        PHARE::amr::visitLevel<GridLayout>(*hierarchy_.getPatchLevel(lvl_),
-                                           *model_.resourcesManager, visit, ions);
+        PHARE::amr::visitLevel<GridLayout>(*level_, *model_.resourcesManager, visit, ions);
 
         return pop_particles;
     }
 
+    /*
+     * particles of population popName on each patch of the level, for each of its particle
+     * arrays (domain, patchGhost and levelGhost), as numpy arrays of particleDtype.
+     * Without box, arrays are read only views of the particles of the simulation, valid until
+     * it advances. Given the lower and upper cells of a box (AMR indexes of the level), arrays
+     * are copies of the particles in that box, and patches without any are skipped.
+     */
+    auto getParticleArrays(std::string popName, std::vector<int> lower, std::vector<int> upper)
+    {
+        using Box = core::Box<int, dimension>;
+
+        std::unordered_map<std::string, std::vector<PatchData<pybind11::array, dimension>>>
+            particleArrays;
+
+        bool const hasBox = lower.size() > 0;
+        if (hasBox and (lower.size() != dimension or upper.size() != dimension))
+            throw std::runtime_error("Error: particle box must have a lower and upper cell of "
+                                     + std::to_string(dimension) + " indexes");
+        Box const box = hasBox ? Box{core::Point<int, dimension>{lower},
+                                     core::Point<int, dimension>{upper}}
+                               : Box{};
+
+        auto addArray = [&](GridLayout& grid, std::string const& patchID, std::string key,
+                            auto const& particles) {
+            auto array = hasBox ? copyParticlesIn(particles, box)
+                                : makeParticlesView(particles, level_);
+            if (array.size() == 0)
+                return;
+
+            auto& patchData = particleArrays[key].emplace_back();
+            setPatchDataFromGrid(patchData, grid, patchID);
+            patchData.data = std::move(array);
+        };
+
+        auto& ions = model_.state.ions;
+
+        auto visit = [&](GridLayout& grid, std::string patchID, std::size_t /*iLevel*/) {
+            for (auto& pop : ions)
+                if (pop.name() == popName)
+                {
+                    addArray(grid, patchID, "domain", pop.domainParticles());
+                    addArray(grid, patchID, "patchGhost", pop.patchGhostParticles());
+                    addArray(grid, patchID, "levelGhost", pop.levelGhostParticles());
+                }
+        };
+
+        PHARE::amr::visitLevel<GridLayout>(*level_, *model_.resourcesManager, visit, ions);
+
+        return particleArrays;
+    }
+
 private:
     std::size_t lvl_;
     amr::Hierarchy& hierarchy_;
     HybridModel& model_;
+
+    // owns the memory of the fields of the level, kept alive by the arrays over them
+    std::shared_ptr<SAMRAI::hier::PatchLevel> level_;
 };
 
 
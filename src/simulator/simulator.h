@@ -7,6 +7,11 @@
 #include "phare_core.h"
 #include "phare_types.h"
 
+#include "core/timers.h"
+#include "core/logger.h"
+
+#include <chrono>
+
 
 
 namespace PHARE
@@ -30,13 +35,14 @@ public:
 
     virtual ~ISimulator() {}
     virtual void dump(double timestamp, double timestep) {} // overriding optional
+    virtual void flush() {}                                 // overriding optional
 };
 
 template<std::size_t _dimension, std::size_t _interp_order, std::size_t _nbRefinedPart>
 class Simulator : public ISimulator
 {
 public:
-    double startTime() override { return 0.; }
+    double startTime() override { return startTime_; }
     double endTime() override { return finalTime_; }
     double timeStep() override { return dt_; }
     double currentTime() override { return currentTime_; }
@@ -56,6 +62,16 @@ public:
 
     void dump(double timestamp, double timestep) override { dMan->dump(timestamp, timestep); }
 
+    // waits for the diagnostics still being written, throwing their errors, and writes the
+    // timers, once the run is over. Collective, all ranks must flush
+    void flush() override
+    {
+        if (dMan)
+            dMan->flush();
+        if (PHARE_TIMERS)
+            core::Timers::INSTANCE().write(timersFile_);
+    }
+
     Simulator(PHARE::initializer::PHAREDict dict,
               std::shared_ptr<PHARE::amr::Hierarchy> const& hierarchy);
 
@@ -97,16 +113,24 @@ private:
     float x_up_[dimension];
     int maxLevelNumber_;
     double dt_;
-    int timeStepNbr_    = 0;
-    double finalTime_   = 0;
-    double currentTime_ = 0;
-    bool isInitialized  = false;
+    int timeStepNbr_         = 0;
+    double finalTime_        = 0;
+    double startTime_        = 0;
+    double currentTime_      = 0;
+    std::size_t currentStep_ = 0;
+    bool restarting_         = false;
+    bool isInitialized       = false;
+
+    // written when the run is flushed, and every timersInterval_ steps if > 0, see core/timers.h
+    std::string timersFile_     = "phare_timers.txt";
+    std::size_t timersInterval_ = 0;
 
     // physical models that can be used
     std::shared_ptr<HybridModel> hybridModel_;
     std::shared_ptr<MHDModel> mhdModel_;
 
     std::unique_ptr<PHARE::diagnostic::IDiagnosticsManager> dMan;
+    std::unique_ptr<PHARE::diagnostic::ICheckpointManager> rMan;
 
     SimFunctors functors_;
 
@@ -137,11 +161,13 @@ Simulator<_dimension, _interp_order, _nbRefinedPart>::Simulator(
     , timeStepNbr_{dict["simulation"]["time_step_nbr"].template to<int>()}
     , finalTime_{dt_ * timeStepNbr_}
     , functors_{functors_setup(dict)}
-    , multiphysInteg_{std::make_shared<MultiPhysicsIntegrator>(
-          dict["simulation"]["AMR"]["max_nbr_levels"].template to<int>(), functors_)}
+    , multiphysInteg_{std::make_shared<MultiPhysicsIntegrator>(dict["simulation"], functors_)}
 {
     if (find_model("HybridModel"))
     {
+        // seeds common to all ranks are drawn once, before any population is loaded
+        core::resolveParticleSeeds(dict["simulation"]["ions"]);
+
         hybridModel_ = std::make_shared<HybridModel>(
             dict["simulation"], std::make_shared<typename HybridModel::resources_manager_type>());
 
@@ -157,12 +183,37 @@ Simulator<_dimension, _interp_order, _nbRefinedPart>::Simulator(
         multiphysInteg_->registerAndSetupMessengers(messengerFactory_);
 
 
-        auto startTime = 0.; // TODO make it runtime
-        auto endTime   = 0.; // TODO make it runtime
+        auto& simDict = dict["simulation"];
+        if (simDict.contains("timers_file"))
+            timersFile_ = simDict["timers_file"].template to<std::string>();
+        if (simDict.contains("timers_interval"))
+            timersInterval_ = simDict["timers_interval"].template to<int>();
+
+        if (simDict.contains("log_file"))
+            core::RunLog::INSTANCE().open(simDict["log_file"].template to<std::string>());
+
+        if (simDict.contains("restarts") && simDict["restarts"].contains("restart_time"))
+        {
+            // sets the time, step and refinement boxes of the checkpoint in the dict
+            PHARE::initializer::RestartDataProvider{dict}.read();
+            startTime_   = simDict["restarts"]["time"].template to<double>();
+            currentTime_ = startTime_;
+            currentStep_ = simDict["restarts"]["step"].template to<int>();
+            restarting_  = true;
+        }
 
+        auto startTime = startTime_;
+        auto endTime   = startTime_; // TODO make it runtime
 
-        integrator_ = std::make_unique<Integrator>(dict, hierarchy, multiphysInteg_,
-                                                   multiphysInteg_, startTime, endTime);
+
+        integrator_ = std::make_unique<Integrator>(
+            dict, hierarchy, multiphysInteg_, multiphysInteg_, startTime, endTime,
+            multiphysInteg_->workloadIndex(),
+            [this]() { multiphysInteg_->computeWorkload(*hierarchy_); });
+
+        if (simDict.contains("restarts"))
+            rMan = PHARE::diagnostic::CheckpointManagerResolver::make_unique(
+                *hierarchy_, *hybridModel_, simDict["restarts"]);
 
         if (dict["simulation"].contains("diagnostics"))
         {
@@ -220,7 +271,15 @@ void Simulator<_dimension, _interp_order, _nbRefinedPart>::initialize()
             std::runtime_error("cannot initialize  - simulator already isInitialized");
 
         if (integrator_ != nullptr)
+        {
+            // levels of a restarting simulation are loaded from the checkpoint
+            if (restarting_)
+                multiphysInteg_->setRestartLoader(
+                    [this](int levelNumber) { rMan->load(levelNumber); });
+
             integrator_->initialize();
+            multiphysInteg_->setRestartLoader(nullptr);
+        }
         else
             throw std::runtime_error("Error - Simulator has no integrator");
     }
@@ -247,8 +306,22 @@ double Simulator<_dimension, _interp_order, _nbRefinedPart>::advance(double dt)
     {
         if (integrator_)
         {
-            auto dt_new = integrator_->advance(dt);
+            auto const start = std::chrono::steady_clock::now();
+            auto dt_new      = integrator_->advance(dt);
             currentTime_ += dt;
+            ++currentStep_;
+
+            if constexpr (PHARE_LOG_LEVEL >= PHARE_LOG_INFO)
+            {
+                std::chrono::duration<double> const seconds
+                    = std::chrono::steady_clock::now() - start;
+                core::RunLog::INSTANCE().stepSummary(currentStep_, currentTime_, seconds.count());
+            }
+
+            if (rMan)
+                rMan->dump(currentTime_, dt, currentStep_);
+            if (PHARE_TIMERS and timersInterval_ > 0 and currentStep_ % timersInterval_ == 0)
+                core::Timers::INSTANCE().write(timersFile_);
             return dt_new;
         }
         else
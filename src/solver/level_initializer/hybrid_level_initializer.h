@@ -15,11 +15,28 @@
 #include "core/data/grid/gridlayout_utils.h"
 #include "core/numerics/ohm/ohm.h"
 #include "core/numerics/ampere/ampere.h"
+#include "initializer/data_provider.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <functional>
 
 namespace PHARE
 {
 namespace solver
 {
+    /*
+     * HybridLevelInitializer computes the moments of a new level once all its particles are
+     * there, depositing the domain and ghost particles of each population in a single pass.
+     * Patches are shared by nbrThreads threads (dict["threads"], default 1), each with its own
+     * view of the ions, built from dict["ions"], and its own interpolator. On the root level, J
+     * does not depend on the moments: the calling thread computes it and fills its ghosts while
+     * the other threads deposit, Ohm then needing both.
+     */
     template<typename HybridModel>
     class HybridLevelInitializer : public LevelInitializer<typename HybridModel::amr_types>
     {
@@ -31,6 +48,7 @@ namespace solver
         using IMessengerT                  = amr::IMessenger<IPhysicalModelT>;
         using HybridMessenger              = amr::HybridMessenger<HybridModel>;
         using GridLayoutT                  = typename HybridModel::gridlayout_type;
+        using Ions                         = typename HybridModel::ions_type;
         static constexpr auto dimension    = GridLayoutT::dimension;
         static constexpr auto interp_order = GridLayoutT::interp_order;
 
@@ -39,24 +57,101 @@ namespace solver
         PHARE::core::Ampere<GridLayoutT> ampere_;
 
 
+        std::size_t nbrThreads_ = 1;
+
+        // views of the ions for the threads other than the calling one
+        std::vector<Ions> threadIons_;
+
+
         inline bool isRootLevel(int levelNumber) const { return levelNumber == 0; }
 
+
+        template<typename Patch>
+        void computeMoments_(HybridModel& hybridModel, Ions& ions, Patch const& patch,
+                             core::Interpolator<dimension, interp_order>& interpolate,
+                             bool rootLevel) const
+        {
+            auto dataOnPatch = hybridModel.resourcesManager->setOnPatch(patch, ions);
+            auto layout      = amr::layoutFromPatch<GridLayoutT>(patch);
+
+            // only finer levels have level ghost particles
+            if (rootLevel)
+                core::resetAndDepositParticles(ions, layout, interpolate, core::DomainDeposit{},
+                                               core::PatchGhostDeposit{});
+            else
+                core::resetAndDepositParticles(ions, layout, interpolate, core::DomainDeposit{},
+                                               core::PatchGhostDeposit{},
+                                               core::LevelGhostDeposit{});
+
+            core::fixMomentGhosts(ions, layout);
+            ions.computeDensity();
+            ions.computeBulkVelocity();
+        }
+
+
+        // overlapped is run by the calling thread while the other threads deposit, before it
+        // deposits too, it must not touch the ions
+        template<typename Level, typename Overlapped>
+        void computeLevelMoments_(HybridModel& hybridModel, Level& level, bool rootLevel,
+                                  Overlapped&& overlapped)
+        {
+            std::vector<std::shared_ptr<patch_t>> patches;
+            for (auto& patch : level)
+                patches.push_back(patch);
+            auto const nbrThreads = std::min(nbrThreads_, patches.size());
+
+            // patches are handed to the threads one at a time, for balance
+            std::atomic<std::size_t> nextPatch{0};
+            auto computeOnPatches = [&](Ions& ions) {
+                core::Interpolator<dimension, interp_order> interpolate;
+                for (auto iPatch = nextPatch++; iPatch < patches.size(); iPatch = nextPatch++)
+                    computeMoments_(hybridModel, ions, *patches[iPatch], interpolate, rootLevel);
+            };
+
+            std::vector<std::thread> threads;
+            for (std::size_t iThread = 1; iThread < nbrThreads; ++iThread)
+                threads.emplace_back(computeOnPatches, std::ref(threadIons_[iThread - 1]));
+            overlapped();
+            computeOnPatches(hybridModel.state.ions);
+            for (auto& thread : threads)
+                thread.join();
+        }
+
+
     public:
+        HybridLevelInitializer() = default;
+
+        explicit HybridLevelInitializer(initializer::PHAREDict const& dict)
+        {
+            if (dict.contains("threads"))
+                nbrThreads_ = std::max(dict["threads"].template to<int>(), 1);
+            for (std::size_t iThread = 1; iThread < nbrThreads_; ++iThread)
+                threadIons_.emplace_back(dict["ions"]);
+        }
+
         virtual void initialize(std::shared_ptr<hierarchy_t> const& hierarchy, int levelNumber,
                                 std::shared_ptr<level_t> const& oldLevel, IPhysicalModelT& model,
                                 amr::IMessenger<IPhysicalModelT>& messenger, double initDataTime,
                                 bool isRegridding) override
         {
-            core::Interpolator<dimension, interp_order> interpolate_;
             auto& hybridModel = static_cast<HybridModel&>(model);
             auto& level       = amr_types::getLevel(*hierarchy, levelNumber);
 
             auto& hybMessenger = dynamic_cast<HybridMessenger&>(messenger);
 
+            bool const restarting = this->restartLoader_ && !isRegridding;
+
 
             if (isRootLevel(levelNumber))
             {
-                model.initialize(level);
+                // a rebalanced root level is copied from the old one, not set to the initial
+                // conditions again
+                if (isRegridding)
+                    messenger.regrid(hierarchy, levelNumber, oldLevel, model, initDataTime);
+                else if (restarting)
+                    this->restartLoader_(levelNumber);
+                else
+                    model.initialize(level);
                 messenger.fillRootGhosts(model, level, initDataTime);
             }
 
@@ -69,54 +164,49 @@ namespace solver
                 else
                 {
                     messenger.initLevel(model, level, initDataTime);
+                    if (restarting)
+                    {
+                        // checkpoint data replaces what was refined from the coarser level,
+                        // patch ghost particles are then exchanged again
+                        this->restartLoader_(levelNumber);
+                        hybMessenger.fillIonGhostParticles(hybridModel.state.ions, level,
+                                                           initDataTime);
+                    }
                     messenger.prepareStep(model, level);
                 }
             }
 
-            // now all particles are here
-
-            for (auto& patch : level)
-            {
-                auto& ions             = hybridModel.state.ions;
-                auto& resourcesManager = hybridModel.resourcesManager;
-                auto dataOnPatch       = resourcesManager->setOnPatch(*patch, ions);
-                auto layout            = amr::layoutFromPatch<GridLayoutT>(*patch);
-
-
-                core::resetMoments(ions);
-                core::depositParticles(ions, layout, interpolate_, core::DomainDeposit{});
-                core::depositParticles(ions, layout, interpolate_, core::PatchGhostDeposit{});
-
-
-                if (!isRootLevel(levelNumber))
-                {
-                    core::depositParticles(ions, layout, interpolate_, core::LevelGhostDeposit{});
-                }
-
-                core::fixMomentGhosts(ions, layout);
-                ions.computeDensity();
-                ions.computeBulkVelocity();
-            }
-
-
-            if (isRootLevel(levelNumber))
-            {
-                auto& B = hybridModel.state.electromag.B;
-                auto& J = hybridModel.state.J;
+            // J and E of a restarted root level are those of the checkpoint, ghost nodes included,
+            // recomputing them from B would not give back the values the checkpointed step ended
+            // with, only their ghosts are filled again. E of a rebalanced root level is copied
+            // from the old level, only J, which is not, is computed from B.
+            auto& B = hybridModel.state.electromag.B;
+            auto& J = hybridModel.state.J;
 
+            auto computeCurrent = [&]() {
                 for (auto& patch : level)
                 {
                     auto _      = hybridModel.resourcesManager->setOnPatch(*patch, B, J);
                     auto layout = PHARE::amr::layoutFromPatch<GridLayoutT>(*patch);
                     auto __     = core::SetLayout(&layout, ampere_);
-                    ampere_(B, J);
+                    if (!restarting)
+                        ampere_(B, J);
 
-                    hybridModel.resourcesManager->setTime(J, *patch, 0.);
+                    hybridModel.resourcesManager->setTime(J, *patch, initDataTime);
                 }
-                hybMessenger.fillCurrentGhosts(J, levelNumber, 0.);
+                hybMessenger.fillCurrentGhosts(J, levelNumber, initDataTime);
+            };
 
+            // now all particles are here
+
+            if (isRootLevel(levelNumber))
+                computeLevelMoments_(hybridModel, level, true, computeCurrent);
+            else
+                computeLevelMoments_(hybridModel, level, false, []() {});
 
 
+            if (isRootLevel(levelNumber))
+            {
                 auto& electrons = hybridModel.state.electrons;
                 auto& E         = hybridModel.state.electromag.E;
 
@@ -124,16 +214,19 @@ namespace solver
                 {
                     auto layout = PHARE::amr::layoutFromPatch<GridLayoutT>(*patch);
                     auto _ = hybridModel.resourcesManager->setOnPatch(*patch, B, E, J, electrons);
-                    electrons.update(layout);
-                    auto& Ve = electrons.velocity();
-                    auto& Ne = electrons.density();
-                    auto& Pe = electrons.pressure();
-                    auto __  = core::SetLayout(&layout, ohm_);
-                    ohm_(Ne, Ve, Pe, B, J, E);
-                    hybridModel.resourcesManager->setTime(E, *patch, 0.);
+                    if (!restarting and !isRegridding)
+                    {
+                        electrons.update(layout);
+                        auto& Ve = electrons.velocity();
+                        auto& Ne = electrons.density();
+                        auto& Pe = electrons.pressure();
+                        auto __  = core::SetLayout(&layout, ohm_);
+                        ohm_(Ne, Ve, Pe, B, J, E);
+                    }
+                    hybridModel.resourcesManager->setTime(E, *patch, initDataTime);
                 }
 
-                hybMessenger.fillElectricGhosts(E, levelNumber, 0.);
+                hybMessenger.fillElectricGhosts(E, levelNumber, initDataTime);
             }
         }
     };
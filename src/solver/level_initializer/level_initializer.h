@@ -4,6 +4,8 @@
 #include "amr/messengers/messenger.h"
 #include "solver/physical_models/physical_model.h"
 
+#include <functional>
+
 namespace PHARE
 {
 namespace solver
@@ -18,6 +20,9 @@ namespace solver
         using IMessengerT     = amr::IMessenger<IPhysicalModelT>;
 
     public:
+        // loads the data of a level from a checkpoint, see setRestartLoader
+        using RestartLoader = std::function<void(int levelNumber)>;
+
         virtual void initialize(std::shared_ptr<hierarchy_t> const& hierarchy, int levelNumber,
                                 std::shared_ptr<level_t> const& oldLevel, IPhysicalModelT& model,
                                 amr::IMessenger<IPhysicalModelT>& messenger, double initDataTime,
@@ -25,7 +30,19 @@ namespace solver
             = 0;
 
 
+        /**
+         * @brief setRestartLoader makes the initializer load the data of new levels with the
+         * given loader instead of initializing them from the model initial conditions or from
+         * coarser data. Regridded levels are initialized as usual. An empty loader restores the
+         * usual initialization.
+         */
+        void setRestartLoader(RestartLoader loader) { restartLoader_ = std::move(loader); }
+
+
         virtual ~LevelInitializer() {}
+
+    protected:
+        RestartLoader restartLoader_;
     };
 } // namespace solver
 } // namespace PHARE
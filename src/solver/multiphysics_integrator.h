@@ -16,6 +16,7 @@
 
 
 #include "amr/messengers/messenger.h"
+#include "amr/load_balancing/workload.h"
 
 #include "solver/physical_models/hybrid_model.h"
 #include "solver/physical_models/mhd_model.h"
@@ -23,10 +24,14 @@
 #include "solver/solvers/solver.h"
 #include "solver/messenger_registration.h"
 #include "solver/level_initializer/level_initializer.h"
+#include "solver/tagging/tagger.h"
+#include "initializer/data_provider.h"
 #include "solvers/solver_mhd.h"
 #include "solver/solvers/solver_ppc.h"
 
 #include "core/utilities/algorithm.h"
+#include "core/timers.h"
+#include "core/logger.h"
 
 #include "phare_core.h"
 
@@ -76,7 +81,8 @@ namespace solver
      * registered IPhysicalModel and ISolver objects
      *
      */
-    template<typename MessengerFactory, typename LevelnitializerFactory, typename AMR_Types>
+    template<typename MessengerFactory, typename LevelnitializerFactory, typename TaggerFactory,
+             typename AMR_Types>
     class MultiPhysicsIntegrator : public SAMRAI::mesh::StandardTagAndInitStrategy,
                                    public SAMRAI::algs::TimeRefinementLevelStrategy
     {
@@ -87,12 +93,21 @@ namespace solver
         static constexpr auto dimension = MessengerFactory::dimension;
 
         // model comes with its variables already registered to the manager system
-        MultiPhysicsIntegrator(int nbrOfLevels, SimFunctors const& simFuncs)
-            : nbrOfLevels_{nbrOfLevels}
-            , levelDescriptors_(nbrOfLevels)
+        MultiPhysicsIntegrator(PHARE::initializer::PHAREDict dict, SimFunctors const& simFuncs)
+            : nbrOfLevels_{dict["AMR"]["max_nbr_levels"].template to<int>()}
+            , levelDescriptors_(nbrOfLevels_)
             , simFuncs_{simFuncs}
 
         {
+            if (dict["AMR"].contains("refinement")
+                && dict["AMR"]["refinement"].contains("tagging"))
+                taggingDict_ = dict["AMR"]["refinement"]["tagging"];
+
+            if (dict.contains("level_initializer"))
+                levelInitializerDict_ = dict["level_initializer"];
+            if (dict.contains("ions"))
+                levelInitializerDict_["ions"] = dict["ions"];
+
             // auto mhdSolver = std::make_unique<SolverMHD<ResourcesManager>>(resourcesManager_);
             // solvers.push_back(std::move(mhdSolver));
 
@@ -119,6 +134,27 @@ namespace solver
 
 
 
+        /**
+         * @brief workloadIndex returns the patch data index of the cell workload to be used by
+         * the load balancer. It is only computed when levels are about to be load balanced, see
+         * computeWorkload and applyGradientDetector
+         */
+        int workloadIndex() const { return workload_.index(); }
+
+
+
+        /**
+         * @brief computeWorkload computes the workload of all the levels of the hierarchy, to be
+         * called before they are rebalanced
+         */
+        void computeWorkload(SAMRAI::hier::PatchHierarchy& hierarchy)
+        {
+            for (int iLevel = 0; iLevel < hierarchy.getNumberOfLevels(); ++iLevel)
+                computeWorkload_(*hierarchy.getPatchLevel(iLevel), getModel_(iLevel));
+        }
+
+
+
 
         /**
          * @brief registerModel registers the model to the multiphysics integrator for a given level
@@ -220,6 +256,20 @@ namespace solver
 
 
 
+        /**
+         * @brief setRestartLoader makes all level initializers load new levels with the given
+         * loader, see LevelInitializer::setRestartLoader. An empty loader restores the usual
+         * initialization.
+         */
+        void setRestartLoader(typename LevelInitializer<AMR_Types>::RestartLoader const& loader)
+        {
+            for (auto& [_, levelInitializer] : levelInitializers_)
+                levelInitializer->setRestartLoader(loader);
+        }
+
+
+
+
         std::string solverName(int const iLevel) const { return getSolver_(iLevel).name(); }
 
 
@@ -284,8 +334,10 @@ namespace solver
             bool const isRegridding = oldLevel != nullptr;
             auto level              = hierarchy->getPatchLevel(levelNumber);
 
-            std::cout << "init level " << levelNumber << " with regriding = " << isRegridding
-                      << "\n";
+            PHARE_TIMER_LEVEL_SCOPE(isRegridding ? "regrid" : "initializeLevelData", levelNumber);
+
+            PHARE_LOG(PHARE_LOG_INFO, core::LogEntry{"initializeLevel"}("level", levelNumber)(
+                                          "regrid", isRegridding)("time", initDataTime));
             if (allocateData)
             {
                 for (auto patch : *level)
@@ -300,6 +352,8 @@ namespace solver
 
             levelInitializer.initialize(hierarchy, levelNumber, oldLevel, model, messenger,
                                         initDataTime, isRegridding);
+
+            workload_.allocate(*level, initDataTime);
         }
 
 
@@ -313,12 +367,29 @@ namespace solver
 
 
         void
-        applyGradientDetector(std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& /*hierarchy*/,
+        applyGradientDetector(std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy,
                               int const levelNumber, double const /*error_data_time*/,
-                              int const /*tag_index*/, bool const /*initialTime*/,
+                              int const tagIndex, bool const /*initialTime*/,
                               bool const /*usesRichardsonExtrapolationToo*/) override
         {
-            std::cout << "apply gradient detector on level " << levelNumber << "\n";
+            // SAMRAI tags a level to regrid the next finer one, which is load balanced according
+            // to the workload of its current patches
+            if (levelNumber + 1 < hierarchy->getNumberOfLevels())
+                computeWorkload_(*hierarchy->getPatchLevel(levelNumber + 1),
+                                 getModel_(levelNumber + 1));
+
+            auto& model  = getModel_(levelNumber);
+            auto& tagger = taggers_[model.name()];
+
+            // models without tagger never ask for refinement
+            if (!tagger)
+                return;
+
+            auto level = hierarchy->getPatchLevel(levelNumber);
+            for (auto& patch : *level)
+            {
+                tagger->tag(model, *patch, tagIndex);
+            }
         }
 
 
@@ -382,8 +453,10 @@ namespace solver
 
 
             auto iLevel = level->getLevelNumber();
-            std::cout << "advanceLevel " << iLevel << " with dt = " << newTime - currentTime
-                      << "\n";
+            PHARE_TIMER_LEVEL_SCOPE("advanceLevel", iLevel);
+
+            PHARE_LOG(PHARE_LOG_DEBUG, core::LogEntry{"advanceLevel"}("level", iLevel)(
+                                           "time", currentTime)("dt", newTime - currentTime));
             auto& solver      = getSolver_(iLevel);
             auto& model       = getModel_(iLevel);
             auto& fromCoarser = getMessengerWithCoarser_(iLevel);
@@ -437,6 +510,8 @@ namespace solver
                                      const std::vector<double>& /*oldTimes*/) override
         {
             // TODO use messengers to sync with coarser
+            PHARE_TIMER_LEVEL_SCOPE("synchronize", finestLevel);
+
             auto& toCoarser = getMessengerWithCoarser_(finestLevel);
             auto level      = hierarchy->getPatchLevel(finestLevel);
             toCoarser.synchronize(*level);
@@ -473,14 +548,31 @@ namespace solver
         std::unordered_map<std::size_t, double> firstNewLevelTimes_;
         using IMessengerT       = amr::IMessenger<IPhysicalModel<AMR_Types>>;
         using LevelInitializerT = LevelInitializer<AMR_Types>;
+        using TaggerT           = Tagger<AMR_Types>;
         std::vector<LevelDescriptor> levelDescriptors_;
         std::vector<std::unique_ptr<ISolver<AMR_Types>>> solvers_;
         std::vector<std::shared_ptr<IPhysicalModel<AMR_Types>>> models_;
         std::map<std::string, std::unique_ptr<IMessengerT>> messengers_;
         std::map<std::string, std::unique_ptr<LevelInitializerT>> levelInitializers_;
+        std::map<std::string, std::unique_ptr<TaggerT>> taggers_;
+        PHARE::initializer::PHAREDict taggingDict_;
+        PHARE::initializer::PHAREDict levelInitializerDict_;
 
         SimFunctors const& simFuncs_;
 
+        amr::Workload workload_{SAMRAI::tbox::Dimension{dimension}};
+
+
+        void computeWorkload_(SAMRAI::hier::PatchLevel& level, IPhysicalModel<AMR_Types>& model)
+        {
+            for (auto& patch : level)
+            {
+                model.computeWorkload(*patch, workload_);
+            }
+        }
+
+
+
 
         bool validLevelRange_(int coarsestLevel, int finestLevel)
         {
@@ -516,7 +608,9 @@ namespace solver
         {
             if (core::notIn(model, models_))
             {
-                levelInitializers_[model->name()] = LevelnitializerFactory::create(model->name());
+                levelInitializers_[model->name()]
+                    = LevelnitializerFactory::create(model->name(), levelInitializerDict_);
+                taggers_[model->name()] = TaggerFactory::create(model->name(), taggingDict_);
                 models_.push_back(std::move(model));
                 int modelIndex = models_.size() - 1;
 
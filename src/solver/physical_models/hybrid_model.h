@@ -93,6 +93,23 @@ namespace solver
         }
 
 
+        /**
+         * @brief computeWorkload weights each cell by the number of domain particles it holds
+         * summed over all populations, particles dominating the cost of the hybrid step.
+         */
+        virtual void computeWorkload(patch_t& patch, amr::Workload const& workload) override
+        {
+            auto _ = resourcesManager->setOnPatch(patch, state.ions);
+
+            workload.reset(patch);
+            for (auto& pop : state.ions)
+            {
+                workload.addParticles(patch, pop.domainParticles());
+            }
+        }
+
+
+
         /**
          * @brief fillMessengerInfo describes which variables of the model are to be initialized or
          * filled at ghost nodes.
@@ -8,6 +8,7 @@
 #include <string>
 
 #include "amr/messengers/messenger_info.h"
+#include "amr/load_balancing/workload.h"
 
 namespace PHARE
 {
@@ -67,6 +68,18 @@ namespace solver
 
 
 
+        /**
+         * @brief computeWorkload sets the computational cost of each cell of the given patch,
+         * used by the load balancer. Concrete models override it when their cost is not
+         * uniform, by default all cells cost the same.
+         */
+        virtual void computeWorkload(patch_t& patch, amr::Workload const& workload)
+        {
+            workload.reset(patch);
+        }
+
+
+
 
         virtual ~IPhysicalModel() = default;
     };
@@ -28,9 +28,10 @@
 #include "core/data/particles/particle_array.h"
 #include "core/data/vecfield/vecfield.h"
 #include "core/data/grid/gridlayout_utils.h"
+#include "core/timers.h"
+#include "core/logger.h"
 
 
-#include <iomanip>
 
 namespace PHARE::solver
 {
@@ -123,6 +124,25 @@ private:
                    core::UpdaterMode mode);
 
 
+    // particles pushed and cells updated on the patch the ions and layout are set on
+    static std::size_t nbrPushedParticles_(Ions& ions)
+    {
+        std::size_t nbrParticles = 0;
+        for (auto const& pop : ions)
+            nbrParticles += pop.domainParticles().size() + pop.patchGhostParticles().size()
+                            + pop.levelGhostParticles().size();
+        return nbrParticles;
+    }
+
+    static std::size_t nbrCells_(GridLayout const& layout)
+    {
+        std::size_t nbrCells = 1;
+        for (auto const nbr : layout.nbrCells())
+            nbrCells *= nbr;
+        return nbrCells;
+    }
+
+
     /*
     template<typename HybridMessenger>
     void syncLevel(HybridMessenger& toCoarser)
@@ -223,6 +243,8 @@ void SolverPPC<HybridModel, AMR_Types>::predictor1_(level_t& level, HybridModel&
                                                     Messenger& fromCoarser,
                                                     double const currentTime, double const newTime)
 {
+    PHARE_TIMER_SCOPE("predictor1");
+
     auto& hybridState      = model.state;
     auto& resourcesManager = model.resourcesManager;
     auto dt                = newTime - currentTime;
@@ -231,6 +253,8 @@ void SolverPPC<HybridModel, AMR_Types>::predictor1_(level_t& level, HybridModel&
 
 
     {
+        PHARE_TIMER_SCOPE("faraday");
+
         auto& Bpred = electromagPred_.B;
         auto& B     = electromag.B;
         auto& E     = electromag.E;
@@ -252,6 +276,8 @@ void SolverPPC<HybridModel, AMR_Types>::predictor1_(level_t& level, HybridModel&
 
 
     {
+        PHARE_TIMER_SCOPE("ampere");
+
         auto& Bpred = electromagPred_.B;
         auto& J     = hybridState.J;
 
@@ -271,6 +297,8 @@ void SolverPPC<HybridModel, AMR_Types>::predictor1_(level_t& level, HybridModel&
 
 
     {
+        PHARE_TIMER_SCOPE("ohm");
+
         auto& electrons = hybridState.electrons;
         auto& Bpred     = electromagPred_.B;
         auto& Epred     = electromagPred_.E;
@@ -299,6 +327,8 @@ void SolverPPC<HybridModel, AMR_Types>::predictor2_(level_t& level, HybridModel&
                                                     Messenger& fromCoarser,
                                                     double const currentTime, double const newTime)
 {
+    PHARE_TIMER_SCOPE("predictor2");
+
     auto& hybridState      = model.state;
     auto& resourcesManager = model.resourcesManager;
     auto dt                = newTime - currentTime;
@@ -307,6 +337,8 @@ void SolverPPC<HybridModel, AMR_Types>::predictor2_(level_t& level, HybridModel&
 
 
     {
+        PHARE_TIMER_SCOPE("faraday");
+
         auto& Bpred = electromagPred_.B;
         auto& B     = hybridState.electromag.B;
         auto& Eavg  = electromagAvg_.E;
@@ -326,6 +358,8 @@ void SolverPPC<HybridModel, AMR_Types>::predictor2_(level_t& level, HybridModel&
 
 
     {
+        PHARE_TIMER_SCOPE("ampere");
+
         auto& Bpred = electromagPred_.B;
         auto& J     = hybridState.J;
 
@@ -344,6 +378,8 @@ void SolverPPC<HybridModel, AMR_Types>::predictor2_(level_t& level, HybridModel&
 
 
     {
+        PHARE_TIMER_SCOPE("ohm");
+
         auto& electrons = hybridState.electrons;
         auto& Bpred     = electromagPred_.B;
         auto& Epred     = electromagPred_.E;
@@ -374,12 +410,16 @@ void SolverPPC<HybridModel, AMR_Types>::corrector_(level_t& level, HybridModel&
                                                    Messenger& fromCoarser, double const currentTime,
                                                    double const newTime)
 {
+    PHARE_TIMER_SCOPE("corrector");
+
     auto& hybridState      = model.state;
     auto& resourcesManager = model.resourcesManager;
     auto dt                = newTime - currentTime;
     auto levelNumber       = level.getLevelNumber();
 
     {
+        PHARE_TIMER_SCOPE("faraday");
+
         auto& B    = hybridState.electromag.B;
         auto& Eavg = electromagAvg_.E;
 
@@ -399,6 +439,8 @@ void SolverPPC<HybridModel, AMR_Types>::corrector_(level_t& level, HybridModel&
 
 
     {
+        PHARE_TIMER_SCOPE("ohm");
+
         auto& electrons = hybridState.electrons;
         auto& B         = hybridState.electromag.B;
         auto& E         = hybridState.electromag.E;
@@ -426,6 +468,8 @@ void SolverPPC<HybridModel, AMR_Types>::corrector_(level_t& level, HybridModel&
 template<typename HybridModel, typename AMR_Types>
 void SolverPPC<HybridModel, AMR_Types>::average_(level_t& level, HybridModel& model)
 {
+    PHARE_TIMER_SCOPE("average");
+
     auto& hybridState      = model.state;
     auto& resourcesManager = model.resourcesManager;
 
@@ -453,33 +497,7 @@ void SolverPPC<HybridModel, AMR_Types>::moveIons_(level_t& level, Ions& ions,
                                                   Messenger& fromCoarser, double const currentTime,
                                                   double const newTime, core::UpdaterMode mode)
 {
-    std::size_t nbrDomainParticles        = 0;
-    std::size_t nbrPatchGhostParticles    = 0;
-    std::size_t nbrLevelGhostNewParticles = 0;
-    std::size_t nbrLevelGhostOldParticles = 0;
-    std::size_t nbrLevelGhostParticles    = 0;
-    for (auto& patch : level)
-    {
-        auto _ = rm.setOnPatch(*patch, ions);
-
-        for (auto& pop : ions)
-        {
-            nbrDomainParticles += pop.domainParticles().size();
-            nbrPatchGhostParticles += pop.patchGhostParticles().size();
-            nbrLevelGhostNewParticles += pop.levelGhostParticlesNew().size();
-            nbrLevelGhostOldParticles += pop.levelGhostParticlesOld().size();
-            nbrLevelGhostParticles += pop.levelGhostParticles().size();
-            nbrPatchGhostParticles += pop.patchGhostParticles().size();
-        }
-    }
-    std::cout << "level = " << level.getLevelNumber() << std::setprecision(6)
-              << " t = " << currentTime << ";  nbrDomParticles = " << nbrDomainParticles
-              << "; LevelGhostNew = " << nbrLevelGhostNewParticles
-              << "; LevelGhostOld = " << nbrLevelGhostOldParticles
-              << "; LevelGhost = " << nbrLevelGhostParticles
-              << "; patchGhost = " << nbrPatchGhostParticles << "\n";
-
-
+    PHARE_TIMER_SCOPE("moveIons");
 
     auto dt = newTime - currentTime;
 
@@ -488,6 +506,16 @@ void SolverPPC<HybridModel, AMR_Types>::moveIons_(level_t& level, Ions& ions,
         auto _ = rm.setOnPatch(*patch, electromag, ions);
 
         auto layout = PHARE::amr::layoutFromPatch<GridLayout>(*patch);
+
+        // counted for the step summary of the run log as the populations are pushed,
+        // cells are updated once per advance, at the last push
+        if constexpr (PHARE_LOG_LEVEL >= PHARE_LOG_INFO)
+        {
+            auto const lastPush = mode == core::UpdaterMode::particles_and_moments;
+            core::RunLog::INSTANCE().count(level.getLevelNumber(), nbrPushedParticles_(ions),
+                                           lastPush ? nbrCells_(layout) : 0);
+        }
+
         ionUpdater_.updatePopulations(ions, electromag, layout, dt, mode);
 
         // this needs to be done before calling the messenger
@@ -0,0 +1,117 @@
+#ifndef PHARE_HYBRID_TAGGER_H
+#define PHARE_HYBRID_TAGGER_H
+
+#include <SAMRAI/hier/Index.h>
+#include <SAMRAI/pdat/CellData.h>
+#include <SAMRAI/pdat/CellIndex.h>
+
+#include "amr/resources_manager/amr_utils.h"
+#include "core/data/grid/gridlayout_utils.h"
+#include "core/numerics/tagging/gradient_detector.h"
+#include "initializer/data_provider.h"
+#include "solver/physical_models/hybrid_model.h"
+#include "solver/physical_models/physical_model.h"
+#include "tagger.h"
+
+#include <memory>
+#include <stdexcept>
+
+namespace PHARE
+{
+namespace solver
+{
+    /**
+     * @brief HybridTagger tags the cells of a hybrid patch where the magnetic field, the current
+     * density or the ion density vary strongly, see core::GradientDetector for the criteria.
+     */
+    template<typename HybridModel>
+    class HybridTagger : public Tagger<typename HybridModel::amr_types>
+    {
+        using amr_types                 = typename HybridModel::amr_types;
+        using patch_t                   = typename amr_types::patch_t;
+        using IPhysicalModelT           = IPhysicalModel<amr_types>;
+        using GridLayoutT               = typename HybridModel::gridlayout_type;
+        static constexpr auto dimension = GridLayoutT::dimension;
+
+        PHARE::core::GradientDetector<GridLayoutT> detector_;
+
+    public:
+        HybridTagger(PHARE::initializer::PHAREDict& dict)
+            : detector_{dict}
+        {
+        }
+
+
+        void tag(IPhysicalModelT& model, patch_t& patch, int tagIndex) override
+        {
+            if (!detector_.active())
+                return;
+
+            auto& hybridModel = static_cast<HybridModel&>(model);
+            auto& B           = hybridModel.state.electromag.B;
+            auto& J           = hybridModel.state.J;
+            auto& ions        = hybridModel.state.ions;
+
+            auto tagData = std::dynamic_pointer_cast<SAMRAI::pdat::CellData<int>>(
+                patch.getPatchData(tagIndex));
+            if (!tagData)
+                throw std::runtime_error("Error - HybridTagger - tag data is not CellData<int>");
+
+            auto _      = hybridModel.resourcesManager->setOnPatch(patch, B, J, ions);
+            auto layout = PHARE::amr::layoutFromPatch<GridLayoutT>(patch);
+            auto __     = core::SetLayout(&layout, detector_);
+
+            auto tags = detector_(B, J, ions.density());
+
+            auto const& lower = patch.getBox().lower();
+            auto const cells  = layout.nbrCells();
+            SAMRAI::hier::Index amrIndex{lower};
+
+            auto setTag = [&](auto const&... cell) {
+                if (tags(cell...) == 1)
+                    (*tagData)(SAMRAI::pdat::CellIndex{amrIndex}) = 1;
+            };
+
+            if constexpr (dimension == 1)
+            {
+                for (std::uint32_t ix = 0; ix < cells[0]; ++ix)
+                {
+                    amrIndex(0) = lower(0) + ix;
+                    setTag(ix);
+                }
+            }
+            if constexpr (dimension == 2)
+            {
+                for (std::uint32_t ix = 0; ix < cells[0]; ++ix)
+                {
+                    amrIndex(0) = lower(0) + ix;
+                    for (std::uint32_t iy = 0; iy < cells[1]; ++iy)
+                    {
+                        amrIndex(1) = lower(1) + iy;
+                        setTag(ix, iy);
+                    }
+                }
+            }
+            if constexpr (dimension == 3)
+            {
+                for (std::uint32_t ix = 0; ix < cells[0]; ++ix)
+                {
+                    amrIndex(0) = lower(0) + ix;
+                    for (std::uint32_t iy = 0; iy < cells[1]; ++iy)
+                    {
+                        amrIndex(1) = lower(1) + iy;
+                        for (std::uint32_t iz = 0; iz < cells[2]; ++iz)
+                        {
+                            amrIndex(2) = lower(2) + iz;
+                            setTag(ix, iy, iz);
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+} // namespace solver
+} // namespace PHARE
+
+#endif
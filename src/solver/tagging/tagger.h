@@ -0,0 +1,33 @@
+#ifndef PHARE_TAGGER_H
+#define PHARE_TAGGER_H
+
+#include "solver/physical_models/physical_model.h"
+
+namespace PHARE
+{
+namespace solver
+{
+    /**
+     * @brief Tagger is the interface of the objects flagging, on a given patch, the cells that
+     * need refinement. It is called by the MultiPhysicsIntegrator when SAMRAI applies the
+     * gradient detector. Concrete taggers depend on the model they tag.
+     */
+    template<typename AMRTypes>
+    class Tagger
+    {
+        using patch_t         = typename AMRTypes::patch_t;
+        using IPhysicalModelT = IPhysicalModel<AMRTypes>;
+
+    public:
+        /**
+         * @brief tag sets to 1 the tag of the cells of the patch that need refinement. Cells not
+         * needing refinement are left untouched. tagIndex is the patch data index of the SAMRAI
+         * integer cell-centered tag data.
+         */
+        virtual void tag(IPhysicalModelT& model, patch_t& patch, int tagIndex) = 0;
+
+        virtual ~Tagger() {}
+    };
+} // namespace solver
+} // namespace PHARE
+#endif
@@ -0,0 +1,38 @@
+#ifndef PHARE_TAGGER_FACTORY_H
+#define PHARE_TAGGER_FACTORY_H
+
+#include "hybrid_tagger.h"
+#include "tagger.h"
+
+#include "initializer/data_provider.h"
+
+#include <memory>
+#include <string>
+
+namespace PHARE
+{
+namespace solver
+{
+    template<typename HybridModel>
+    class TaggerFactory
+    {
+        using AMRTypes = typename HybridModel::amr_types;
+
+    public:
+        static std::unique_ptr<Tagger<AMRTypes>> create(std::string modelName,
+                                                        PHARE::initializer::PHAREDict& dict)
+        {
+            if (modelName == "HybridModel")
+            {
+                return std::make_unique<HybridTagger<HybridModel>>(dict);
+            }
+            return nullptr;
+        }
+    };
+
+} // namespace solver
+} // namespace PHARE
+
+
+
+#endif
@@ -0,0 +1,217 @@
+#include <SAMRAI/hier/Box.h>
+#include <SAMRAI/hier/IntVector.h>
+#include <SAMRAI/tbox/SAMRAIManager.h>
+#include <SAMRAI/tbox/SAMRAI_MPI.h>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+
+#include "amr/data/field/coarsening/field_coarsener.h"
+#include "amr/data/field/coarsening/field_coarsener_ratio2.h"
+#include "amr/data/field/refine/field_refiner.h"
+#include "amr/data/field/refine/field_refiner_ratio2.h"
+#include "core/data/field/field.h"
+#include "core/data/ndarray/ndarray_vector.h"
+#include "core/hybrid/hybrid_quantities.h"
+#include "core/utilities/point/point.h"
+
+
+#include <array>
+#include <random>
+#include <string>
+#include <type_traits>
+
+using namespace PHARE::core;
+using namespace PHARE::amr;
+
+
+
+/*
+ * The ratio 2 kernels must give the same values as the generic FieldCoarsener and FieldRefiner,
+ * which use the CoarsenWeighter and LinearWeighter tables, for every centering combination.
+ * Boxes are given in AMR field indexes and start at negative indexes so that the parity of the
+ * fine indexes and the shifts of the stencils are both exercised.
+ */
+template<typename DimConstant>
+class AFieldRatio2Kernel : public ::testing::Test
+{
+protected:
+    static constexpr std::size_t dimension = DimConstant::value;
+
+    using FieldT = Field<NdArrayVector<dimension>, HybridQuantity::Scalar>;
+
+    SAMRAI::tbox::Dimension const dim{static_cast<unsigned short>(dimension)};
+    SAMRAI::hier::IntVector const ratio{dim, 2};
+
+    // ghost boxes of the fine and coarse patches
+    SAMRAI::hier::Box const fineGhostBox{box_(-3, 30)};
+    SAMRAI::hier::Box const coarseGhostBox{box_(-5, 20)};
+
+    // nodes computed, their stencils stay within the ghost boxes
+    SAMRAI::hier::Box const coarsenedBox{box_(0, 12)};
+    SAMRAI::hier::Box const refinedBox{box_(-3, 20)};
+
+    std::mt19937 generator{1};
+
+
+    SAMRAI::hier::Box box_(int lower, int upper) const
+    {
+        return SAMRAI::hier::Box{SAMRAI::hier::Index{dim, lower}, SAMRAI::hier::Index{dim, upper},
+                                 SAMRAI::hier::BlockId{0}};
+    }
+
+
+    FieldT makeField(SAMRAI::hier::Box const& ghostBox)
+    {
+        std::array<std::uint32_t, dimension> shape;
+        for (std::size_t iDir = 0; iDir < dimension; ++iDir)
+            shape[iDir] = static_cast<std::uint32_t>(ghostBox.numberCells(iDir));
+        return FieldT{"field", HybridQuantity::Scalar::Bx, shape};
+    }
+
+
+    void randomize(FieldT& field)
+    {
+        std::uniform_real_distribution<double> uniform{-1., 1.};
+        for (auto& value : field)
+            value = uniform(generator);
+    }
+
+
+    // calls fn with each AMR index of box
+    template<typename Fn>
+    static void forEachIndex(SAMRAI::hier::Box const& box, Fn&& fn)
+    {
+        Point<int, dimension> index;
+        if constexpr (dimension == 1)
+        {
+            for (index[0] = box.lower(0); index[0] <= box.upper(0); ++index[0])
+                fn(index);
+        }
+        if constexpr (dimension == 2)
+        {
+            for (index[0] = box.lower(0); index[0] <= box.upper(0); ++index[0])
+                for (index[1] = box.lower(1); index[1] <= box.upper(1); ++index[1])
+                    fn(index);
+        }
+        if constexpr (dimension == 3)
+        {
+            for (index[0] = box.lower(0); index[0] <= box.upper(0); ++index[0])
+                for (index[1] = box.lower(1); index[1] <= box.upper(1); ++index[1])
+                    for (index[2] = box.lower(2); index[2] <= box.upper(2); ++index[2])
+                        fn(index);
+        }
+    }
+
+
+    // all the 2^dimension combinations of primal and dual centerings
+    static auto centerings()
+    {
+        std::vector<std::array<QtyCentering, dimension>> centerings;
+        for (std::size_t bits = 0; bits < (1u << dimension); ++bits)
+        {
+            std::array<QtyCentering, dimension> centering;
+            for (std::size_t iDir = 0; iDir < dimension; ++iDir)
+                centering[iDir] = (bits >> iDir) & 1u ? QtyCentering::dual : QtyCentering::primal;
+            centerings.push_back(centering);
+        }
+        return centerings;
+    }
+
+
+    static std::string toString(std::array<QtyCentering, dimension> const& centering)
+    {
+        std::string name;
+        for (auto c : centering)
+            name += c == QtyCentering::primal ? "primal " : "dual ";
+        return name;
+    }
+};
+
+using Dimensions = ::testing::Types<std::integral_constant<std::size_t, 1>,
+                                    std::integral_constant<std::size_t, 2>,
+                                    std::integral_constant<std::size_t, 3>>;
+
+TYPED_TEST_SUITE(AFieldRatio2Kernel, Dimensions);
+
+
+
+TYPED_TEST(AFieldRatio2Kernel, coarsensLikeTheGenericCoarsener)
+{
+    for (auto const& centering : this->centerings())
+    {
+        SCOPED_TRACE(this->toString(centering));
+
+        auto fine = this->makeField(this->fineGhostBox);
+        this->randomize(fine);
+
+        auto expected = this->makeField(this->coarseGhostBox);
+        auto actual   = this->makeField(this->coarseGhostBox);
+
+        FieldCoarsener<TestFixture::dimension> coarsener{centering, this->fineGhostBox,
+                                                         this->coarseGhostBox, this->ratio};
+        this->forEachIndex(this->coarsenedBox,
+                           [&](auto const& index) { coarsener(fine, expected, index); });
+
+        FieldCoarsenerRatio2<TestFixture::dimension>{centering, this->fineGhostBox,
+                                                     this->coarseGhostBox}(fine, actual,
+                                                                           this->coarsenedBox);
+
+        this->forEachIndex(this->coarsenedBox, [&](auto const& index) {
+            auto local = AMRToLocal(index, this->coarseGhostBox).template toArray<int>();
+            EXPECT_NEAR(expected(local), actual(local), 1e-14);
+        });
+    }
+}
+
+
+
+TYPED_TEST(AFieldRatio2Kernel, refinesLikeTheGenericRefiner)
+{
+    for (auto const& centering : this->centerings())
+    {
+        SCOPED_TRACE(this->toString(centering));
+
+        auto coarse = this->makeField(this->coarseGhostBox);
+        this->randomize(coarse);
+
+        auto expected = this->makeField(this->fineGhostBox);
+        auto actual   = this->makeField(this->fineGhostBox);
+
+        FieldRefiner<TestFixture::dimension> refiner{centering, this->fineGhostBox,
+                                                     this->coarseGhostBox, this->ratio};
+        this->forEachIndex(this->refinedBox,
+                           [&](auto const& index) { refiner(coarse, expected, index); });
+
+        FieldRefinerRatio2<TestFixture::dimension>{centering, this->fineGhostBox,
+                                                   this->coarseGhostBox}(coarse, actual,
+                                                                         this->refinedBox);
+
+        this->forEachIndex(this->refinedBox, [&](auto const& index) {
+            auto local = AMRToLocal(index, this->fineGhostBox).template toArray<int>();
+            EXPECT_NEAR(expected(local), actual(local), 1e-14);
+        });
+    }
+}
+
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    SAMRAI::tbox::SAMRAI_MPI::init(&argc, &argv);
+    SAMRAI::tbox::SAMRAIManager::initialize();
+    SAMRAI::tbox::SAMRAIManager::startup();
+
+
+    int testResult = RUN_ALL_TESTS();
+
+    // Finalize
+    SAMRAI::tbox::SAMRAIManager::shutdown();
+    SAMRAI::tbox::SAMRAIManager::finalize();
+    SAMRAI::tbox::SAMRAI_MPI::finalize();
+
+    return testResult;
+}
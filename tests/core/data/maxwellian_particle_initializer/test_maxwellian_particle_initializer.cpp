@@ -22,10 +22,26 @@ using namespace PHARE::initializer;
 
 class AMaxwellianParticleInitializer1D : public ::testing::Test
 {
-private:
+protected:
     using GridLayoutT       = GridLayout<GridLayoutImplYee<1, 1>>;
     using ParticleArrayT    = ParticleArray<1>;
     using InitFunctionArray = std::array<InitFunction<1>, 3>;
+    using InitializerT      = MaxwellianParticleInitializer<ParticleArrayT, GridLayoutT>;
+
+    auto seededInitializer(std::size_t nbrThreads,
+                           std::optional<std::array<double, 1>> domainOrigin = {}) const
+    {
+        return InitializerT{density,
+                            InitFunctionArray{vx, vy, vz},
+                            InitFunctionArray{vthx, vthy, vthz},
+                            1.,
+                            nbrParticlesPerCell,
+                            std::size_t{42},
+                            Basis::Cartesian,
+                            {nullptr, nullptr, nullptr},
+                            nbrThreads,
+                            domainOrigin};
+    }
 
 public:
     AMaxwellianParticleInitializer1D()
@@ -76,6 +92,64 @@ TEST_F(AMaxwellianParticleInitializer1D, loadsParticlesInTheDomain)
 
 
 
+TEST_F(AMaxwellianParticleInitializer1D, loadsTheSameParticlesWhateverTheNbrOfThreads)
+{
+    ParticleArrayT threadedParticles;
+    seededInitializer(1).loadParticles(particles, layout);
+    seededInitializer(4).loadParticles(threadedParticles, layout);
+
+    ASSERT_EQ(particles.size(), threadedParticles.size());
+    for (std::size_t i = 0; i < particles.size(); ++i)
+        EXPECT_TRUE(particles[i] == threadedParticles[i]);
+}
+
+
+
+
+TEST_F(AMaxwellianParticleInitializer1D, loadsTheSameParticlesWhateverTheDomainDecomposition)
+{
+    GridLayoutT lowerHalf{{{0.1}}, {{25}}, Point{0.}, Box{Point{50}, Point{74}}};
+    GridLayoutT upperHalf{{{0.1}}, {{25}}, Point{2.5}, Box{Point{75}, Point{99}}};
+
+    ParticleArrayT halves;
+    seededInitializer(1).loadParticles(particles, layout);
+    seededInitializer(1).loadParticles(halves, lowerHalf);
+    seededInitializer(1).loadParticles(halves, upperHalf);
+
+    // profiles are evaluated at the cell centers of each patch, up to rounding
+    ASSERT_EQ(particles.size(), halves.size());
+    for (std::size_t i = 0; i < particles.size(); ++i)
+    {
+        EXPECT_EQ(particles[i].iCell, halves[i].iCell);
+        EXPECT_EQ(particles[i].delta, halves[i].delta);
+        for (std::size_t c = 0; c < 3; ++c)
+            EXPECT_NEAR(particles[i].v[c], halves[i].v[c], 1e-12);
+    }
+}
+
+
+
+
+TEST_F(AMaxwellianParticleInitializer1D, loadsIdenticalParticlesGivenTheDomainOrigin)
+{
+    // the AMR index 50 of the layout is at x = 0
+    std::array<double, 1> const domainOrigin{-5.};
+    GridLayoutT lowerHalf{{{0.1}}, {{25}}, Point{0.}, Box{Point{50}, Point{74}}};
+    GridLayoutT upperHalf{{{0.1}}, {{25}}, Point{2.5}, Box{Point{75}, Point{99}}};
+
+    ParticleArrayT halves;
+    seededInitializer(1, domainOrigin).loadParticles(particles, layout);
+    seededInitializer(1, domainOrigin).loadParticles(halves, lowerHalf);
+    seededInitializer(1, domainOrigin).loadParticles(halves, upperHalf);
+
+    ASSERT_EQ(particles.size(), halves.size());
+    for (std::size_t i = 0; i < particles.size(); ++i)
+        EXPECT_TRUE(particles[i] == halves[i]);
+}
+
+
+
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,136 @@
+#include "core/data/grid/gridlayout.h"
+#include "core/data/grid/gridlayoutimplyee.h"
+#include "core/data/ions/particle_initializers/particle_initializer_factory.h"
+#include "core/data/particles/particle_array.h"
+#include "core/utilities/mpi_utils.h"
+#include "initializer/data_provider.h"
+
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+#include <optional>
+
+using namespace PHARE::core;
+using namespace PHARE::initializer;
+
+#include "tests/initializer/init_functions.h"
+using namespace PHARE::initializer::test_fn::func_1d; // density/etc are here
+
+
+using GridLayoutT    = GridLayout<GridLayoutImplYee<1, 1>>;
+using ParticleArrayT = ParticleArray<1>;
+using FactoryT       = ParticleInitializerFactory<ParticleArrayT, GridLayoutT>;
+
+std::size_t constexpr nbrCells = 100;
+double constexpr meshSize      = 0.1;
+
+
+// ions of one unseeded population loaded independently of the domain decomposition
+PHAREDict unseededIons()
+{
+    PHAREDict ions;
+    ions["nbrPopulations"] = int{1};
+
+    auto& info                 = ions["pop0"]["particle_initializer"];
+    info["name"]               = std::string{"maxwellian"};
+    info["density"]            = static_cast<InitFunction<1>>(density);
+    info["bulk_velocity_x"]    = static_cast<InitFunction<1>>(vx);
+    info["bulk_velocity_y"]    = static_cast<InitFunction<1>>(vy);
+    info["bulk_velocity_z"]    = static_cast<InitFunction<1>>(vz);
+    info["thermal_velocity_x"] = static_cast<InitFunction<1>>(vthx);
+    info["thermal_velocity_y"] = static_cast<InitFunction<1>>(vthy);
+    info["thermal_velocity_z"] = static_cast<InitFunction<1>>(vthz);
+    info["charge"]             = 1.;
+    info["nbr_part_per_cell"]  = int{100};
+    info["basis"]              = std::string{"cartesian"};
+
+    auto& init                 = info["init"];
+    init["seed"]               = std::optional<std::size_t>{};
+    init["domain_origin"]["x"] = 0.;
+    return ions;
+}
+
+
+// the domain split in nbrPatches patches, an initializer being created for each as the model does
+ParticleArrayT loadPatches(PHAREDict& info, std::size_t const nbrPatches)
+{
+    ParticleArrayT particles;
+    std::size_t const cellsPerPatch = nbrCells / nbrPatches;
+    for (std::size_t iPatch = 0; iPatch < nbrPatches; ++iPatch)
+    {
+        int const lower = static_cast<int>(iPatch * cellsPerPatch);
+        int const upper
+            = iPatch + 1 == nbrPatches ? static_cast<int>(nbrCells) - 1
+                                   : lower + static_cast<int>(cellsPerPatch) - 1;
+        GridLayoutT layout{{{meshSize}},
+                           {{static_cast<std::uint32_t>(upper - lower + 1)}},
+                           Point{lower * meshSize},
+                           Box{Point{lower}, Point{upper}}};
+        FactoryT::create(info)->loadParticles(particles, layout);
+    }
+    return particles;
+}
+
+
+
+TEST(ResolvedParticleSeeds, areTheSameOnAllRanks)
+{
+    auto ions = unseededIons();
+    resolveParticleSeeds(ions);
+
+    auto seed = ions["pop0"]["particle_initializer"]["init"]["seed"]
+                    .to<std::optional<std::size_t>>();
+    ASSERT_TRUE(seed);
+    for (auto const& rankSeed : mpi::collect(*seed))
+        EXPECT_EQ(*seed, rankSeed);
+}
+
+
+
+TEST(ResolvedParticleSeeds, loadTheSameParticlesOnRanksOwningDifferentNbrOfPatches)
+{
+    auto ions = unseededIons();
+    resolveParticleSeeds(ions);
+
+    // each rank loads the whole domain, split in a different number of patches on each rank
+    auto& info     = ions["pop0"]["particle_initializer"];
+    auto particles = loadPatches(info, static_cast<std::size_t>(mpi::rank()) + 1);
+
+    double sum = 0;
+    for (auto const& particle : particles)
+        sum += particle.v[0] + particle.v[1] + particle.v[2] + particle.delta[0];
+
+    auto const nbrParticles = mpi::collect(particles.size());
+    auto const sums         = mpi::collect(sum);
+    for (int rank = 0; rank < mpi::size(); ++rank)
+    {
+        EXPECT_EQ(particles.size(), nbrParticles[rank]);
+        EXPECT_EQ(sum, sums[rank]);
+    }
+}
+
+
+
+TEST(ResolvedParticleSeeds, areNotDrawnForPopulationsGivenASeed)
+{
+    auto ions    = unseededIons();
+    auto& init   = ions["pop0"]["particle_initializer"]["init"];
+    init["seed"] = std::optional<std::size_t>{42};
+    resolveParticleSeeds(ions);
+
+    EXPECT_EQ(std::size_t{42}, *init["seed"].to<std::optional<std::size_t>>());
+}
+
+
+
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleTest(&argc, argv);
+
+    auto const result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
+}
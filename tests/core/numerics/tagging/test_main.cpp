@@ -0,0 +1,197 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/data/field/field.h"
+#include "core/data/grid/gridlayout.h"
+#include "core/data/grid/gridlayout_impl.h"
+#include "core/data/grid/gridlayoutdefs.h"
+#include "core/data/vecfield/vecfield.h"
+#include "core/numerics/tagging/gradient_detector.h"
+
+using namespace PHARE::core;
+
+
+PHARE::initializer::PHAREDict createDict(std::string criterion, double threshold)
+{
+    PHARE::initializer::PHAREDict dict;
+    dict[criterion] = threshold;
+    return dict;
+}
+
+
+
+template<std::size_t dim>
+struct GradientDetectorTest : public ::testing::Test
+{
+    using GridLayoutImpl = GridLayoutImplYee<dim, 1>;
+    using GridLayoutT    = GridLayout<GridLayoutImpl>;
+    using FieldT         = Field<NdArrayVector<dim>, HybridQuantity::Scalar>;
+
+    static constexpr std::uint32_t nbrCells = 20;
+    static constexpr double meshSize        = 0.1;
+
+    GridLayoutT layout;
+
+    FieldT Bx, By, Bz, Jx, Jy, Jz, rho;
+    VecField<NdArrayVector<dim>, HybridQuantity> B;
+    VecField<NdArrayVector<dim>, HybridQuantity> J;
+
+    GradientDetectorTest()
+        : layout{ConstArray<double, dim>(meshSize), ConstArray<std::uint32_t, dim>(nbrCells),
+                 Point<double, dim>{ConstArray<double, dim>(0.)}}
+        , Bx{"Bx", HybridQuantity::Scalar::Bx, layout.allocSize(HybridQuantity::Scalar::Bx)}
+        , By{"By", HybridQuantity::Scalar::By, layout.allocSize(HybridQuantity::Scalar::By)}
+        , Bz{"Bz", HybridQuantity::Scalar::Bz, layout.allocSize(HybridQuantity::Scalar::Bz)}
+        , Jx{"Jx", HybridQuantity::Scalar::Jx, layout.allocSize(HybridQuantity::Scalar::Jx)}
+        , Jy{"Jy", HybridQuantity::Scalar::Jy, layout.allocSize(HybridQuantity::Scalar::Jy)}
+        , Jz{"Jz", HybridQuantity::Scalar::Jz, layout.allocSize(HybridQuantity::Scalar::Jz)}
+        , rho{"rho", HybridQuantity::Scalar::rho, layout.allocSize(HybridQuantity::Scalar::rho)}
+        , B{"B", HybridQuantity::Vector::B}
+        , J{"J", HybridQuantity::Vector::J}
+    {
+        B.setBuffer("B_x", &Bx);
+        B.setBuffer("B_y", &By);
+        B.setBuffer("B_z", &Bz);
+        J.setBuffer("J_x", &Jx);
+        J.setBuffer("J_y", &Jy);
+        J.setBuffer("J_z", &Jz);
+
+        for (auto* field : {&Bx, &By, &Bz, &rho})
+            std::fill(field->begin(), field->end(), 1.);
+        for (auto* field : {&Jx, &Jy, &Jz})
+            std::fill(field->begin(), field->end(), 0.);
+    }
+
+
+    // sets Bx to 1 for x < x0 and to 2 beyond, Bx is primal in x
+    void stepBx(std::uint32_t x0)
+    {
+        auto start = layout.physicalStartIndex(Bx, Direction::X);
+        setStep_(Bx, start + x0);
+    }
+
+    // sets rho to 1 for x < x0 and to 2 beyond, rho is primal in x
+    void stepDensity(std::uint32_t x0)
+    {
+        auto start = layout.physicalStartIndex(rho, Direction::X);
+        setStep_(rho, start + x0);
+    }
+
+    auto tag(PHARE::initializer::PHAREDict dict)
+    {
+        GradientDetector<GridLayoutT> detector{dict};
+        auto _ = SetLayout(&layout, detector);
+        return detector(B, J, rho);
+    }
+
+private:
+    void setStep_(FieldT& field, std::uint32_t ix0)
+    {
+        auto shape = field.shape();
+        if constexpr (dim == 1)
+        {
+            for (std::uint32_t ix = ix0; ix < shape[0]; ++ix)
+                field(ix) = 2.;
+        }
+        if constexpr (dim == 2)
+        {
+            for (std::uint32_t ix = ix0; ix < shape[0]; ++ix)
+                for (std::uint32_t iy = 0; iy < shape[1]; ++iy)
+                    field(ix, iy) = 2.;
+        }
+    }
+};
+
+using GradientDetector1DTest = GradientDetectorTest<1>;
+using GradientDetector2DTest = GradientDetectorTest<2>;
+
+
+
+TEST_F(GradientDetector1DTest, uniformFieldsAreNotTagged)
+{
+    auto tags = tag(createDict("grad_B", 0.1));
+    EXPECT_TRUE(std::all_of(tags.begin(), tags.end(), [](auto t) { return t == 0; }));
+}
+
+
+TEST_F(GradientDetector1DTest, noThresholdMeansNoTag)
+{
+    stepBx(10);
+    PHARE::initializer::PHAREDict dict;
+    GradientDetector<GridLayoutT> detector{dict};
+
+    EXPECT_FALSE(detector.active());
+}
+
+
+TEST_F(GradientDetector1DTest, magneticJumpIsTaggedOnlyWhereItOccurs)
+{
+    stepBx(10);
+    auto tags = tag(createDict("grad_B", 0.1));
+
+    // the jump sits between nodes 9 and 10, i.e. in cell 9 only
+    for (std::uint32_t ix = 0; ix < nbrCells; ++ix)
+        EXPECT_EQ(ix == 9 ? 1 : 0, tags(ix));
+}
+
+
+TEST_F(GradientDetector1DTest, densityJumpIsTaggedOnlyWhereItOccurs)
+{
+    stepDensity(10);
+    auto tags = tag(createDict("density_jump", 0.1));
+
+    for (std::uint32_t ix = 0; ix < nbrCells; ++ix)
+        EXPECT_EQ(ix == 9 ? 1 : 0, tags(ix));
+}
+
+
+TEST_F(GradientDetector1DTest, largeCurrentIsTagged)
+{
+    // dx |J| / |B| = 0.1 * 2 / sqrt(3) ~ 0.115
+    std::fill(Jy.begin(), Jy.end(), 2.);
+    auto tags = tag(createDict("current", 0.1));
+    EXPECT_TRUE(std::all_of(tags.begin(), tags.end(), [](auto t) { return t == 1; }));
+
+    tags = tag(createDict("current", 0.2));
+    EXPECT_TRUE(std::all_of(tags.begin(), tags.end(), [](auto t) { return t == 0; }));
+}
+
+
+TEST_F(GradientDetector1DTest, currentIsRelativeToTheMagneticField)
+{
+    std::fill(Jy.begin(), Jy.end(), 2.);
+    for (auto* field : {&Bx, &By, &Bz})
+        std::fill(field->begin(), field->end(), 10.);
+
+    auto tags = tag(createDict("current", 0.1));
+    EXPECT_TRUE(std::all_of(tags.begin(), tags.end(), [](auto t) { return t == 0; }));
+
+    // the same current relative to the field is tagged whatever the units
+    for (auto* field : {&Jx, &Jy, &Jz})
+        std::transform(field->begin(), field->end(), field->begin(), [](auto j) { return 10 * j; });
+    tags = tag(createDict("current", 0.1));
+    EXPECT_TRUE(std::all_of(tags.begin(), tags.end(), [](auto t) { return t == 1; }));
+}
+
+
+TEST_F(GradientDetector2DTest, magneticJumpIsTaggedOnAllCellsAlongTheJump)
+{
+    stepBx(10);
+    auto tags = tag(createDict("grad_B", 0.1));
+
+    for (std::uint32_t ix = 0; ix < nbrCells; ++ix)
+        for (std::uint32_t iy = 0; iy < nbrCells; ++iy)
+            EXPECT_EQ(ix == 9 ? 1 : 0, tags(ix, iy));
+}
+
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
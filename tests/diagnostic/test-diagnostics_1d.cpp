@@ -21,6 +21,11 @@ TYPED_TEST(Simulator1dTest, electromag)
     electromag_test(TypeParam{job_file}, out_dir);
 }
 
+TYPED_TEST(Simulator1dTest, reduced)
+{
+    reduced_test(TypeParam{job_file}, out_dir);
+}
+
 TYPED_TEST(Simulator1dTest, allFromPython)
 {
     allFromPython_test(TypeParam{job_file}, out_dir);
@@ -8,7 +8,9 @@
 #include "diagnostic/detail/types/electromag.h"
 #include "diagnostic/detail/types/particle.h"
 #include "diagnostic/detail/types/fluid.h"
+#include "diagnostic/detail/types/reduced.h"
 
+#include <numeric>
 #include <functional>
 
 
@@ -220,12 +222,26 @@ struct Hi5Diagnostic
     auto electromag(std::string&& type) { return dict("electromag", type); }
     auto particles(std::string&& type) { return dict("particle", type); }
     auto fluid(std::string&& type) { return dict("fluid", type); }
+    auto reduced(std::string&& type) { return dict("reduced", type); }
+    auto velocityDistribution(std::string&& type)
+    {
+        auto dict        = reduced(std::forward<std::string>(type));
+        dict["axes"]     = std::string{"vx,vy,vz"};
+        dict["nbr_bins"] = std::vector<double>{20, 20, 20};
+        dict["ranges"]   = std::vector<double>{-100, 100, -100, 100, -100, 100};
+        return dict;
+    }
 
     std::string getPatchPath(int level, std::string patch, std::string timestamp = "0.000000")
     {
         return Writer_t::getFullPatchPath(timestamp, level, patch);
     }
 
+    std::string getLevelPath(int level, std::string timestamp = "0.000000")
+    {
+        return Writer_t::getFullLevelPath(timestamp, level);
+    }
+
     Hierarchy& hierarchy_;
     HybridModel& model_;
     std::string out_;
@@ -364,6 +380,107 @@ void validateParticleDump(Simulator& sim, Hi5Diagnostic& hi5)
 }
 
 
+/*
+ * replaces the proton domain particles by a drifting Maxwellian whose moments are exact: each
+ * cell holds six particles of weight w, at V +- vth along each axis, the drift V changing from
+ * cell to cell. The energies of a cell are then
+ *   kinetic = 3 m w (|V|^2 + vth^2)
+ *   thermal = 3 m w vth^2, in the frame of the drift of the cell
+ * returns the expected kinetic energy, thermal energy and weight per level
+ */
+template<typename Simulator>
+std::vector<double> setDriftingMaxwellian(Simulator& sim)
+{
+    using GridLayout = typename Simulator::PHARETypes::GridLayout_t;
+    using Particle   = core::Particle<Simulator::dimension>;
+
+    double const weight = 0.1, vth = 0.5;
+
+    auto& hybridModel = *sim.getHybridModel();
+    auto nbrLevels    = static_cast<std::size_t>(sim.hierarchy->getNumberOfLevels());
+
+    std::vector<double> local(3 * nbrLevels, 0.);
+    auto visit = [&](GridLayout& layout, std::string, std::size_t iLevel) {
+        auto const box = layout.AMRBox();
+        for (auto& pop : hybridModel.state.ions)
+        {
+            if (pop.name() != "protons")
+                continue;
+
+            auto& particles = pop.domainParticles();
+            particles.clear();
+
+            auto addCell = [&](auto const& iCell) {
+                std::array<double, 3> const drift{1. + iCell[0] % 3, 0.5, -0.2};
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                    for (double sign : {-1., 1.})
+                    {
+                        Particle particle;
+                        particle.weight = weight;
+                        particle.charge = 1.;
+                        particle.iCell  = iCell;
+                        particle.delta.fill(0.5);
+                        particle.v = drift;
+                        particle.v[axis] += sign * vth;
+                        particles.push_back(particle);
+                    }
+
+                auto const drift2 = drift[0] * drift[0] + drift[1] * drift[1] + drift[2] * drift[2];
+                local[3 * iLevel] += 3. * pop.mass() * weight * (drift2 + vth * vth);
+                local[3 * iLevel + 1] += 3. * pop.mass() * weight * vth * vth;
+                local[3 * iLevel + 2] += 6. * weight;
+            };
+
+            std::array<int, Simulator::dimension> iCell;
+            if constexpr (Simulator::dimension == 1)
+            {
+                for (iCell[0] = box.lower[0]; iCell[0] <= box.upper[0]; ++iCell[0])
+                    addCell(iCell);
+            }
+            if constexpr (Simulator::dimension == 2)
+            {
+                for (iCell[0] = box.lower[0]; iCell[0] <= box.upper[0]; ++iCell[0])
+                    for (iCell[1] = box.lower[1]; iCell[1] <= box.upper[1]; ++iCell[1])
+                        addCell(iCell);
+            }
+        }
+    };
+
+    PHARE::amr::visitHierarchy<GridLayout>(*sim.hierarchy, *hybridModel.resourcesManager, visit, 0,
+                                           sim.hierarchy->getNumberOfLevels(), hybridModel);
+    return core::mpi::sum(local);
+}
+
+
+template<typename Simulator, typename Hi5Diagnostic>
+void validateReducedDump(Simulator& sim, Hi5Diagnostic& hi5, std::vector<double> const& expected)
+{
+    auto nbrLevels = static_cast<std::size_t>(sim.hierarchy->getNumberOfLevels());
+
+    auto energy = hi5.writer.makeFile(hi5.writer.fileString("/energy"));
+    auto distribution
+        = hi5.writer.makeFile(hi5.writer.fileString("/ions/pop/protons/velocity_distribution"));
+
+    for (std::size_t iLevel = 0; iLevel < nbrLevels; iLevel++)
+    {
+        auto path = hi5.getLevelPath(iLevel) + "/";
+        std::vector<double> magnetic, kinetic, thermal, vx;
+        energy->file().getDataSet(path + "magnetic").read(magnetic);
+        energy->file().getDataSet(path + "protons/kinetic").read(kinetic);
+        energy->file().getDataSet(path + "protons/thermal").read(thermal);
+        distribution->file().getDataSet(path + "vx").read(vx);
+
+        EXPECT_GE(magnetic[0], 0.);
+        EXPECT_NEAR(expected[3 * iLevel], kinetic[0], 1e-10 * expected[3 * iLevel]);
+        EXPECT_NEAR(expected[3 * iLevel + 1], thermal[0], 1e-10 * expected[3 * iLevel + 1]);
+
+        ASSERT_EQ(vx.size(), 20u);
+        EXPECT_NEAR(expected[3 * iLevel + 2], std::accumulate(vx.begin(), vx.end(), 0.),
+                    1e-10 * expected[3 * iLevel + 2]);
+    }
+}
+
+
 template<typename Simulator, typename Hi5Diagnostic>
 void validateAttributes(Simulator& sim, Hi5Diagnostic& hi5)
 {
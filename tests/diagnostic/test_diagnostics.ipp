@@ -74,6 +74,29 @@ void particles_test(Simulator&& sim, std::string out_dir)
 }
 
 
+template<typename Simulator>
+void reduced_test(Simulator&& sim, std::string out_dir)
+{
+    using HybridModel = typename Simulator::HybridModel;
+    using Hierarchy   = typename Simulator::Hierarchy;
+
+    auto& hybridModel = *sim.getHybridModel();
+    auto& hierarchy   = *sim.hierarchy;
+    auto expected     = setDriftingMaxwellian(sim);
+
+    { // scoped to destruct after dump
+        Hi5Diagnostic<Hierarchy, HybridModel> hi5{hierarchy, hybridModel, out_dir, NEW_HI5_FILE};
+        hi5.dMan.addDiagDict(hi5.reduced("/energy"))
+            .addDiagDict(hi5.velocityDistribution("/ions/pop/protons/velocity_distribution"));
+        sim.dump(hi5.dMan);
+    }
+
+    Hi5Diagnostic<Hierarchy, HybridModel> hi5{hierarchy, hybridModel, out_dir,
+                                              HighFive::File::ReadOnly};
+    validateReducedDump(sim, hi5, expected);
+}
+
+
 template<typename Simulator>
 void allFromPython_test(Simulator&& sim, std::string out_dir)
 {
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+# serialized by the test-initializer build into job.phd, read by SerializedDataProvider
+
+from pyphare.pharein import Simulation
+from pyphare.pharein import MaxwellianFluidModel
+from pyphare.pharein import ElectronModel
+from pyphare.pharein import profiles
+
+Simulation(
+    smallest_patch_size=10,
+    largest_patch_size=64,
+    time_step_nbr=1000,
+    final_time=1.,
+    boundary_types="periodic",
+    cells=65,
+    dl=1./65,
+    refinement_boxes = {"L0":{"B0":[(10,),(50,)]}},
+)
+
+uniform = profiles.uniform(1.)
+
+MaxwellianFluidModel(
+    bx=profiles.tanh(amplitude=2., center=.5, width=.1), by=uniform, bz=uniform,
+    protons={"charge":1, "density":profiles.harris(amplitude=2., center=.5, width=.1, background=.2),
+             "vbulkx":uniform, "vbulky":uniform, "vbulkz":uniform,
+             "vthx":uniform, "vthy":uniform, "vthz":uniform, "init":{"seed":1337}},
+)
+
+ElectronModel(closure="isothermal",Te = 0.12)
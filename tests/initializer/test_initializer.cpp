@@ -5,8 +5,10 @@
 
 
 #include "initializer/data_provider.h"
+#include "initializer/analytic_profiles.h"
 #include "initializer/python_data_provider.h"
 #include "initializer/restart_data_provider.h"
+#include "initializer/serialized_data_provider.h"
 
 
 #include "core/data/grid/gridlayoutdefs.h"
@@ -120,9 +122,91 @@ TEST(APythonDataProvider, providesAValidTree)
 
 
 
+TEST(ASerializedDataProvider, providesTheTreeOfTheSerializedJob)
+{
+    // job.phd is serialized from job_serialized.py when building the test
+    PHAREDict input;
+    SerializedDataProvider{"job.phd", input}.read();
+
+    auto& simulation = input["simulation"];
+    EXPECT_EQ(1, simulation["dimension"].to<int>());
+    EXPECT_EQ(1, simulation["interp_order"].to<int>());
+    EXPECT_DOUBLE_EQ(0.001, simulation["time_step"].to<double>());
+    EXPECT_EQ(1000, simulation["time_step_nbr"].to<int>());
+    EXPECT_EQ("yee", simulation["grid"]["layout_type"].to<std::string>());
+    EXPECT_EQ(65, simulation["grid"]["nbr_cells"]["x"].to<int>());
+    EXPECT_DOUBLE_EQ(1. / 65., simulation["grid"]["meshsize"]["x"].to<double>());
+    EXPECT_EQ("modified_boris",
+              simulation["algo"]["ion_updater"]["pusher"]["name"].to<std::string>());
+
+    auto& refinementBox = simulation["AMR"]["refinement"]["boxes"]["L0"]["B0"];
+    EXPECT_EQ(10, refinementBox["lower"]["x"].to<int>());
+    EXPECT_EQ(50, refinementBox["upper"]["x"].to<int>());
+
+    EXPECT_EQ(1, simulation["ions"]["nbrPopulations"].to<int>());
+    auto& pop0 = simulation["ions"]["pop0"];
+    EXPECT_EQ("protons", pop0["name"].to<std::string>());
+    EXPECT_DOUBLE_EQ(1., pop0["mass"].to<double>());
+
+    auto& init = pop0["particle_initializer"];
+    EXPECT_EQ("maxwellian", init["name"].to<std::string>());
+    EXPECT_DOUBLE_EQ(1., init["charge"].to<double>());
+    EXPECT_EQ(std::size_t{1337}, *init["init"]["seed"].to<std::optional<std::size_t>>());
+
+    // profiles are evaluated in C++, harris and tanh peak and vanish at the center
+    std::vector<double> const x{.5, .6};
+    auto density = init["density"].to<InitFunction<1>>()(x);
+    EXPECT_DOUBLE_EQ(2.2, (*density)[0]);
+    EXPECT_DOUBLE_EQ(.2 + 2. / std::pow(std::cosh(1.), 2), (*density)[1]);
+
+    auto bx = simulation["electromag"]["magnetic"]["initializer"]["x_component"]
+                  .to<InitFunction<1>>()(x);
+    EXPECT_DOUBLE_EQ(0., (*bx)[0]);
+    EXPECT_DOUBLE_EQ(2. * std::tanh(1.), (*bx)[1]);
+
+    auto vthx = init["thermal_velocity_x"].to<InitFunction<1>>()(x);
+    EXPECT_DOUBLE_EQ(1., (*vthx)[1]);
+
+    EXPECT_EQ("isothermal", simulation["electrons"]["pressure_closure"]["name"].to<std::string>());
+    EXPECT_DOUBLE_EQ(0.12, simulation["electrons"]["pressure_closure"]["Te"].to<double>());
+}
+
+
+
+TEST(AnAnalyticProfile, isEvaluatedAlongItsAxis)
+{
+    auto harris = makeAnalyticProfile<1>(
+        "harris", {{"amplitude", 2.}, {"center", 1.}, {"width", .5}, {"background", .1}});
+    auto density = harris(std::vector<double>{1., 1.5});
+    EXPECT_DOUBLE_EQ(2.1, (*density)[0]);
+    EXPECT_DOUBLE_EQ(.1 + 2. / std::pow(std::cosh(1.), 2), (*density)[1]);
+
+    auto tanh = makeAnalyticProfile<2>("tanh", {{"axis", 1.}, {"width", 2.}});
+    auto bx   = tanh(std::vector<double>{0., 0.}, std::vector<double>{0., 2.});
+    EXPECT_DOUBLE_EQ(0., (*bx)[0]);
+    EXPECT_DOUBLE_EQ(std::tanh(1.), (*bx)[1]);
+
+    auto uniform = makeAnalyticProfile<1>("uniform", {{"value", 3.}});
+    EXPECT_EQ(3u, uniform(std::vector<double>(3, 0.))->size());
+    EXPECT_DOUBLE_EQ(3., (*uniform(std::vector<double>{7.}))[0]);
+}
+
+
+TEST(AnAnalyticProfile, throwsIfItIsUnknownOrInvalid)
+{
+    EXPECT_THROW(makeAnalyticProfile<1>("gaussian", {}), std::runtime_error);
+    EXPECT_THROW(makeAnalyticProfile<1>("tanh", {{"axis", 1.}}), std::runtime_error);
+    EXPECT_THROW(makeAnalyticProfile<2>("harris", {{"width", 0.}}), std::runtime_error);
+}
+
+
+
 int main(int argc, char** argv)
 {
+    MPI_Init(&argc, &argv); // the serialized data provider broadcasts the file
     ::testing::InitGoogleTest(&argc, argv);
 
-    return RUN_ALL_TESTS();
+    auto const result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
 }
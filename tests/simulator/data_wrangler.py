@@ -32,12 +32,34 @@ class DataWranglerTest(unittest.TestCase):
             print("\n", self.dw.lvl0PopFluxes())
             print("\n", self.dw.lvl0EM())
 
+            for patch in self.dw.getPatchLevel(0).getDensity():
+                self.assertTrue(isinstance(patch.data, np.ndarray))
+                self.assertFalse(patch.data.flags.writeable)
+
+            density = self.dw.lvl0IonDensity()
+            root_density = self.dw.lvl0IonDensity(root_only=True)
+            if cpp.mpi_rank() == 0:
+                np.testing.assert_array_equal(density, root_density)
+            else:
+                self.assertEqual(root_density.size, 0)
+
             for pop, particles in self.dw.getPatchLevel(0).getParticles().items():
                 for key, patches in particles.items():
                     for patch in patches:
                         self.assertTrue(isinstance(patch.lower, np.ndarray))
                         self.assertTrue(isinstance(patch.upper, np.ndarray))
 
+            level = self.dw.getPatchLevel(0)
+            for pop in level.getParticles().keys():
+                for key, patches in level.getParticleArrays(pop).items():
+                    for patch in patches:
+                        self.assertFalse(patch.data.flags.writeable)
+                        self.assertEqual(patch.data["v"].shape, (patch.data.size, 3))
+
+                for patch in level.getParticleArrays(pop, [10], [20]).get("domain", []):
+                    self.assertTrue((patch.data["iCell"] >= 10).all())
+                    self.assertTrue((patch.data["iCell"] <= 20).all())
+
             self.simulator = None
 
     def tearDown(self):
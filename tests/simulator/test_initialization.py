@@ -25,7 +25,8 @@ class InitializationTest(unittest.TestCase):
                      beam = False,
                      smallest_patch_size=10, largest_patch_size=10,
                      cells= 120,
-                     dl=0.1):
+                     dl=0.1,
+                     level_init_threads=1):
 
         from pyphare.pharein import global_vars
         global_vars.sim =None
@@ -40,6 +41,7 @@ class InitializationTest(unittest.TestCase):
             dl=dl,
             interp_order=interp_order,
             refinement_boxes=refinement_boxes,
+            level_init_threads=level_init_threads,
             diag_options={"format": "phareh5",
                           "options": {"dir": diag_outputs, "mode":"overwrite"}}
         )
@@ -363,6 +365,37 @@ class InitializationTest(unittest.TestCase):
 
 
 
+    @data(1, 2, 3)
+    def test_threaded_level_moments_are_those_of_a_single_thread(self, interp_order):
+        print("test_threaded_level_moments_are_those_of_a_single_thread : interp_order : {}".format(interp_order))
+
+        # small patches, so that each level has more patches than threads
+        refinement_boxes = {"L0": {"B0": [(10, ), (50, )]}}
+        kwargs = {"nbr_part_per_cell": 100, "beam": True,
+                  "smallest_patch_size": 5, "largest_patch_size": 5}
+
+        hiers = [self.getHierarchy(interp_order, refinement_boxes, "moments",
+                                   diag_outputs="phare_outputs_threads_{}".format(threads),
+                                   level_init_threads=threads, **kwargs) for threads in (1, 4)]
+
+        single, threaded = hiers
+        self.assertEqual(single.levels().keys(), threaded.levels().keys())
+        for ilvl, level in single.levels().items():
+            threaded_patches = threaded.level(ilvl).patches
+            self.assertEqual(len(level.patches), len(threaded_patches))
+            self.assertTrue(len(level.patches) > 4)
+
+            for patch, threaded_patch in zip(level.patches, threaded_patches):
+                self.assertEqual(patch.box, threaded_patch.box)
+                self.assertEqual(patch.patch_datas.keys(), threaded_patch.patch_datas.keys())
+                for name, pdata in patch.patch_datas.items():
+                    # each patch is computed by one thread, the deposits are in the same order
+                    np.testing.assert_array_equal(pdata.dataset[:],
+                                                  threaded_patch.patch_datas[name].dataset[:])
+
+
+
+
     @data(1, 2, 3)
     def test_density_decreases_as_1overSqrtN(self,interp_order):
         import matplotlib
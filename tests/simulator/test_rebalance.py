@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+
+"""
+  Rebalancing the hierarchy moves patches across MPI ranks but must not change the data of the
+  root level, which is copied from the old root level and not set to the initial conditions again.
+  A simulation rebalanced after every coarse time step must end with the root level of the same
+  simulation never rebalanced.
+"""
+
+from pybindlibs import cpp
+from pyphare.simulator.simulator import Simulator, startMPI
+from pyphare.pharesee.hierarchy import hierarchy_from
+from tests.simulator.test_restarts import simArgs, final_time, setup_model, add_diagnostics
+from tests.simulator.test_restarts import level_field, level_particles, assert_particles_close
+import pyphare.pharein as ph
+import unittest
+import os
+import numpy as np
+from ddt import ddt, data
+
+
+out = "phare_outputs/rebalance/"
+
+
+
+@ddt
+class RebalanceTest(unittest.TestCase):
+
+    def __init__(self, *args, **kwargs):
+        super(RebalanceTest, self).__init__(*args, **kwargs)
+        startMPI()
+        self.simulator = None
+
+
+    def tearDown(self):
+        if self.simulator is not None:
+            self.simulator.reset()
+        self.simulator = None
+        ph.global_vars.sim = None
+
+
+    def run_simulation(self, diag_dir, interp_order, rebalance_interval):
+        ph.global_vars.sim = None
+        simulation = ph.Simulation(**simArgs, interp_order=interp_order,
+                                   smallest_patch_size=5, largest_patch_size=10,
+                                   rebalance_interval=rebalance_interval,
+                                   diag_options={"format": "phareh5",
+                                                 "options": {"dir": diag_dir, "mode": "overwrite"}})
+        setup_model()
+        add_diagnostics()
+
+        self.simulator = Simulator(simulation).initialize()
+        self.simulator.run()
+        self.simulator.reset()
+        self.simulator = None
+        ph.global_vars.sim = None
+
+
+    def root_level(self, diag_dir, quantity):
+        time = "t{:.6f}".format(final_time)
+        hier = hierarchy_from(h5_filename=os.path.join(diag_dir, quantity + ".h5"), time=time)
+        return hier.level(0, final_time)
+
+
+    @data(1, 2, 3)
+    def test_rebalanced_root_level_is_unchanged(self, interp_order):
+        print("test_rebalanced_root_level_is_unchanged : interp_order : {}".format(interp_order))
+
+        local_out = f"{out}interp{interp_order}_mpi_n_{cpp.mpi_size()}"
+        static_dir, rebalanced_dir = local_out + "/static", local_out + "/rebalanced"
+
+        self.run_simulation(static_dir, interp_order, rebalance_interval=0)
+        self.run_simulation(rebalanced_dir, interp_order, rebalance_interval=1)
+
+        # patches may be split differently, only the order of floating point operations changes
+        for quantity in ["EM_E", "EM_B"]:
+            static, rebalanced = (self.root_level(d, quantity) for d in (static_dir, rebalanced_dir))
+            for component in ["x", "y", "z"]:
+                name = quantity + "_" + component
+                expected = level_field(static, name)
+                actual   = level_field(rebalanced, name)
+                self.assertEqual(expected.keys(), actual.keys())
+                keys = sorted(expected.keys())
+                np.testing.assert_allclose([actual[k] for k in keys],
+                                           [expected[k] for k in keys], rtol=1e-10, atol=1e-12)
+
+        quantity = "ions_pop_protons_domain"
+        assert_particles_close(self, level_particles(self.root_level(rebalanced_dir, quantity)),
+                               level_particles(self.root_level(static_dir, quantity)))
+
+
+
+if __name__ == "__main__":
+    unittest.main()
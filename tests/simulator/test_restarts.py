@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+
+"""
+  A simulation restarted from a checkpoint, with patches of another size so that levels are
+  decomposed differently across patches and MPI ranks, must end with the fields, particles and
+  time of the uninterrupted simulation that wrote the checkpoint.
+"""
+
+from pybindlibs import cpp
+from pyphare.pharein import ElectronModel
+from pyphare.simulator.simulator import Simulator, startMPI
+from pyphare.pharesee.hierarchy import hierarchy_from
+import pyphare.pharein as ph
+import unittest
+import os
+import h5py
+import numpy as np
+from ddt import ddt, data
+
+
+out = "phare_outputs/restarts/"
+
+time_step_nbr   = 10
+final_time      = 0.01
+checkpoint_time = 0.005
+
+simArgs = {
+  "time_step_nbr": time_step_nbr,
+  "final_time": final_time,
+  "boundary_types": "periodic",
+  "cells": 40,
+  "dl": 0.3,
+  "refinement_boxes": {"L0": {"B0": [(10, ), (19, )]}},
+}
+
+
+def setup_model():
+    def density(x):
+        return 1.
+
+    def bx(x):
+        return 1.
+
+    def by(x):
+        L = ph.global_vars.sim.simulation_domain()
+        return 0.1*np.cos(2*np.pi*x/L[0])
+
+    def bz(x):
+        L = ph.global_vars.sim.simulation_domain()
+        return 0.1*np.sin(2*np.pi*x/L[0])
+
+    def vx(x):
+        return 0.
+
+    def vy(x):
+        L = ph.global_vars.sim.simulation_domain()
+        return 0.1*np.cos(2*np.pi*x/L[0])
+
+    def vz(x):
+        L = ph.global_vars.sim.simulation_domain()
+        return 0.1*np.sin(2*np.pi*x/L[0])
+
+    def vth(x):
+        return 0.01 + np.zeros_like(x)
+
+    ph.MaxwellianFluidModel(
+        bx=bx, by=by, bz=bz,
+        protons={"charge": 1, "density": density,
+                 "vbulkx": vx, "vbulky": vy, "vbulkz": vz,
+                 "vthx": vth, "vthy": vth, "vthz": vth,
+                 "init": {"seed": 1337}}
+    )
+    ElectronModel(closure="isothermal", Te=0.12)
+
+
+def add_diagnostics():
+    for quantity in ["E", "B"]:
+        ph.ElectromagDiagnostics(quantity=quantity, write_timestamps=[final_time],
+                                 compute_timestamps=[final_time])
+    ph.ParticleDiagnostics(quantity="domain", write_timestamps=[final_time],
+                           compute_timestamps=[final_time], population_name="protons")
+
+
+
+def level_field(level, name):
+    """
+      values of the field on the level, keyed by node index, ghost nodes excluded
+    """
+    values = {}
+    for patch in level.patches:
+        pdata = patch.patch_datas[name]
+        dl, lower = pdata.dl[0], pdata.origin[0]
+        upper = lower + patch.box.shape()[0] * dl
+        x = pdata.x[:]
+        interior = (x > lower - dl/4) & (x < upper + dl/4)
+        for xi, value in zip(x[interior], pdata.dataset[:][interior]):
+            values[int(round(2*xi/dl))] = value
+    return values
+
+
+def level_particles(level):
+    """
+      sorted positions, in cells, velocity components and weights of the domain particles of the
+      level, each sorted independently so that particles pushed to within round off errors of
+      each other compare equal whatever their order
+    """
+    positions, v, weights = [], [], []
+    for patch in level.patches:
+        particles = patch.patch_datas["protons_particles"].dataset
+        iCells = np.asarray(particles.iCells[:]).reshape(-1)
+        positions.append(iCells + np.asarray(particles.deltas[:]).reshape(-1))
+        v.append(np.asarray(particles.v[:]).reshape(-1, 3))
+        weights.append(np.asarray(particles.weights[:]).reshape(-1))
+    v = np.concatenate(v)
+    return [np.sort(np.concatenate(positions))] + [np.sort(v[:, i]) for i in range(3)] \
+         + [np.sort(np.concatenate(weights))]
+
+
+def assert_particles_close(test, actual, expected):
+    """
+      patches holding particles differently, only the order of floating point operations of the
+      push and deposit changes: particles are the same, each to within round off errors, but a
+      particle may have crossed a cell edge in one run and not in the other, so that their cells
+      are not compared
+    """
+    test.assertEqual(len(actual[0]), len(expected[0]))
+    for a, e in zip(actual, expected):
+        np.testing.assert_allclose(a, e, rtol=1e-10, atol=1e-10)
+
+
+
+@ddt
+class RestartsTest(unittest.TestCase):
+
+    def __init__(self, *args, **kwargs):
+        super(RestartsTest, self).__init__(*args, **kwargs)
+        startMPI()
+        self.simulator = None
+
+
+    def tearDown(self):
+        if self.simulator is not None:
+            self.simulator.reset()
+        self.simulator = None
+        ph.global_vars.sim = None
+
+
+    def run_simulation(self, diag_dir, restart_options, **patch_sizes):
+        ph.global_vars.sim = None
+        simulation = ph.Simulation(**simArgs, **patch_sizes, restart_options=restart_options,
+                                   diag_options={"format": "phareh5",
+                                                 "options": {"dir": diag_dir, "mode": "overwrite"}})
+        setup_model()
+        add_diagnostics()
+
+        self.simulator = Simulator(simulation).initialize()
+        start_time = self.simulator.cpp_sim.startTime()
+        self.simulator.run()
+        end_time = self.simulator.currentTime()
+        self.simulator.reset()
+        self.simulator = None
+        ph.global_vars.sim = None
+        return start_time, end_time
+
+
+    def hierarchy(self, diag_dir, quantity):
+        time = "t{:.6f}".format(final_time)
+        return hierarchy_from(h5_filename=os.path.join(diag_dir, quantity + ".h5"), time=time)
+
+
+    @data(1, 2, 3)
+    def test_restarted_simulation_ends_like_the_uninterrupted_one(self, interp_order):
+        print("test_restarted_simulation_ends_like_the_uninterrupted_one : interp_order : {}".format(interp_order))
+        simArgs["interp_order"] = interp_order
+
+        local_out = f"{out}interp{interp_order}_mpi_n_{cpp.mpi_size()}"
+        checkpoint_dir = local_out + "/checkpoints"
+        full_dir, restarted_dir = local_out + "/uninterrupted", local_out + "/restarted"
+
+        full_start, full_end = self.run_simulation(
+            full_dir, {"dir": checkpoint_dir, "timestamps": [checkpoint_time]},
+            smallest_patch_size=5, largest_patch_size=5)
+
+        restarted_start, restarted_end = self.run_simulation(
+            restarted_dir, {"dir": checkpoint_dir, "timestamps": [checkpoint_time],
+                            "restart_time": checkpoint_time},
+            smallest_patch_size=10, largest_patch_size=20)
+
+        # written at the closest time step, and named after its time
+        dt = final_time / time_step_nbr
+        checkpoint_step_time = round(checkpoint_time / dt) * dt
+        checkpoint = os.path.join(checkpoint_dir, "checkpoint_{:.10f}.h5".format(checkpoint_step_time))
+        with h5py.File(checkpoint, "r") as h5:
+            checkpointed_time = h5.attrs["time"]
+
+        self.assertEqual(full_start, 0)
+        self.assertEqual(restarted_start, checkpointed_time)
+        self.assertTrue(0 < restarted_start < final_time)
+        self.assertAlmostEqual(full_end, restarted_end, places=12)
+
+        # the restarted run only differs by the order of floating point operations
+        t = final_time
+        for quantity in ["EM_E", "EM_B"]:
+            full, restarted = (self.hierarchy(d, quantity) for d in (full_dir, restarted_dir))
+            self.assertEqual(full.levels(t).keys(), restarted.levels(t).keys())
+            for ilvl, level in full.levels(t).items():
+                for component in ["x", "y", "z"]:
+                    name = quantity + "_" + component
+                    expected = level_field(level, name)
+                    actual   = level_field(restarted.level(ilvl, t), name)
+                    self.assertEqual(expected.keys(), actual.keys())
+                    keys = sorted(expected.keys())
+                    np.testing.assert_allclose([actual[k] for k in keys],
+                                               [expected[k] for k in keys], rtol=1e-10, atol=1e-12)
+
+        full, restarted = (self.hierarchy(d, "ions_pop_protons_domain") for d in (full_dir, restarted_dir))
+        self.assertEqual(full.levels(t).keys(), restarted.levels(t).keys())
+        for ilvl, level in full.levels(t).items():
+            assert_particles_close(self, level_particles(restarted.level(ilvl, t)),
+                                   level_particles(level))
+
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,144 @@
+#include "bench/core/bench.h"
+
+#include "amr/data/field/coarsening/field_coarsen_operator.h"
+#include "amr/data/field/field_geometry.h"
+#include "amr/data/field/field_variable.h"
+#include "amr/data/field/refine/field_refine_operator.h"
+#include "phare/phare.h"
+
+#include <SAMRAI/hier/BoxContainer.h>
+#include <SAMRAI/hier/Patch.h>
+#include <SAMRAI/hier/PatchDescriptor.h>
+
+using Scalar = PHARE::core::HybridQuantity::Scalar;
+
+
+SAMRAI::hier::Box box(SAMRAI::tbox::Dimension const& dimension, int lower, int upper)
+{
+    return SAMRAI::hier::Box{SAMRAI::hier::Index{dimension, lower},
+                             SAMRAI::hier::Index{dimension, upper}, SAMRAI::hier::BlockId{0}};
+}
+
+
+/*
+ * a coarse patch of the given number of cells in each direction and the fine patch covering it
+ * for the given refinement ratio, with a field of the given quantity. The ratio 2 has its own
+ * kernels, other ratios go through the generic coarsener and refiner.
+ */
+template<std::size_t dim, Scalar qty>
+struct LevelPair
+{
+    using PHARE_Types  = PHARE::core::PHARE_Types<dim, /*interp=*/1>;
+    using GridLayout_t = typename PHARE_Types::GridLayout_t;
+    using Field_t      = typename PHARE_Types::Field_t;
+    using FieldData_t  = PHARE::amr::FieldData<GridLayout_t, Field_t>;
+
+    LevelPair(int cells, int refinementRatio)
+        : ratio{dimension, refinementRatio}
+        , coarsePatch{box(dimension, 0, cells - 1), patchDescriptor}
+        , finePatch{box(dimension, 0, refinementRatio * cells - 1), patchDescriptor}
+    {
+        for (auto* patch : {&coarsePatch, &finePatch})
+        {
+            patch->allocatePatchData(id);
+            auto& field = FieldData_t::getField(*patch, id);
+            std::fill(field.begin(), field.end(), 1.);
+        }
+    }
+
+    // bytes of the coarse and fine fields
+    std::size_t bytes() const
+    {
+        return (FieldData_t::getField(coarsePatch, id).size()
+                + FieldData_t::getField(finePatch, id).size())
+               * sizeof(double);
+    }
+
+    SAMRAI::tbox::Dimension dimension{dim};
+
+    PHARE::amr::FieldVariable<GridLayout_t, Field_t> variable{"field", qty};
+    std::shared_ptr<SAMRAI::hier::PatchDescriptor> patchDescriptor{
+        std::make_shared<SAMRAI::hier::PatchDescriptor>()};
+    int id{patchDescriptor->definePatchDataComponent("field", variable.getPatchDataFactory())};
+
+    SAMRAI::hier::IntVector ratio;
+    SAMRAI::hier::Patch coarsePatch;
+    SAMRAI::hier::Patch finePatch;
+};
+
+
+// coarsens the fine field on the whole coarse patch, as at the synchronization of the levels
+template<std::size_t dim, Scalar qty>
+void coarsen(benchmark::State& state)
+{
+    using LevelPair_t = LevelPair<dim, qty>;
+
+    LevelPair_t levels(state.range(0), state.range(1));
+    PHARE::amr::FieldCoarsenOperator<typename LevelPair_t::GridLayout_t,
+                                     typename LevelPair_t::Field_t>
+        coarsenOperator;
+    auto const& coarseBox = levels.coarsePatch.getBox();
+
+    while (state.KeepRunning())
+    {
+        coarsenOperator.coarsen(levels.coarsePatch, levels.finePatch, levels.id, levels.id,
+                                coarseBox, levels.ratio);
+        benchmark::ClobberMemory();
+    }
+
+    auto const& coarseField = LevelPair_t::FieldData_t::getField(levels.coarsePatch, levels.id);
+    PHARE::core::bench::setRate(state, "nodes/s", coarseField.size());
+    state.SetBytesProcessed(state.iterations() * levels.bytes());
+}
+
+
+// refines the coarse field on the whole fine patch, as when a new level is initialized
+template<std::size_t dim, Scalar qty>
+void refine(benchmark::State& state)
+{
+    using LevelPair_t  = LevelPair<dim, qty>;
+    using GridLayout_t = typename LevelPair_t::GridLayout_t;
+
+    LevelPair_t levels(state.range(0), state.range(1));
+    PHARE::amr::FieldRefineOperator<GridLayout_t, typename LevelPair_t::Field_t> refineOperator;
+
+    auto const& fineLayout = LevelPair_t::FieldData_t::getLayout(levels.finePatch, levels.id);
+    auto const fineBox     = PHARE::amr::FieldGeometry<GridLayout_t, Scalar>::toFieldBox(
+        levels.finePatch.getBox(), qty, fineLayout, /*withGhost=*/false);
+    PHARE::amr::FieldOverlap const overlap{
+        SAMRAI::hier::BoxContainer{fineBox},
+        SAMRAI::hier::Transformation{SAMRAI::hier::IntVector::getZero(levels.dimension)}};
+
+    while (state.KeepRunning())
+    {
+        refineOperator.refine(levels.finePatch, levels.coarsePatch, levels.id, levels.id, overlap,
+                              levels.ratio);
+        benchmark::ClobberMemory();
+    }
+
+    PHARE::core::bench::setRate(state, "nodes/s", fineBox.size());
+    state.SetBytesProcessed(state.iterations() * levels.bytes());
+}
+
+
+// arguments are the number of cells of the coarse patch and the refinement ratio
+BENCHMARK_TEMPLATE(coarsen, /*dim=*/1, Scalar::Bx)->Args({1024, 2})->Args({1024, 4});
+BENCHMARK_TEMPLATE(coarsen, /*dim=*/1, Scalar::Ex)->Args({1024, 2})->Args({1024, 4});
+BENCHMARK_TEMPLATE(coarsen, /*dim=*/2, Scalar::Bx)->Args({64, 2})->Args({64, 4});
+BENCHMARK_TEMPLATE(coarsen, /*dim=*/2, Scalar::Ex)->Args({64, 2})->Args({64, 4});
+BENCHMARK_TEMPLATE(coarsen, /*dim=*/3, Scalar::Bx)->Args({16, 2})->Args({16, 4});
+BENCHMARK_TEMPLATE(coarsen, /*dim=*/3, Scalar::Ex)->Args({16, 2})->Args({16, 4});
+
+BENCHMARK_TEMPLATE(refine, /*dim=*/1, Scalar::Bx)->Args({1024, 2})->Args({1024, 4});
+BENCHMARK_TEMPLATE(refine, /*dim=*/1, Scalar::Ex)->Args({1024, 2})->Args({1024, 4});
+BENCHMARK_TEMPLATE(refine, /*dim=*/2, Scalar::Bx)->Args({64, 2})->Args({64, 4});
+BENCHMARK_TEMPLATE(refine, /*dim=*/2, Scalar::Ex)->Args({64, 2})->Args({64, 4});
+BENCHMARK_TEMPLATE(refine, /*dim=*/3, Scalar::Bx)->Args({16, 2})->Args({16, 4});
+BENCHMARK_TEMPLATE(refine, /*dim=*/3, Scalar::Ex)->Args({16, 2})->Args({16, 4});
+
+int main(int argc, char** argv)
+{
+    PHARE::SamraiLifeCycle samrai(argc, argv);
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
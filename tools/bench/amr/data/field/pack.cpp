@@ -0,0 +1,122 @@
+#include "bench/core/bench.h"
+
+#include "amr/data/field/field_data.h"
+#include "amr/data/field/field_variable.h"
+#include "phare/phare.h"
+
+#include <SAMRAI/hier/Patch.h>
+#include <SAMRAI/hier/PatchDescriptor.h>
+#include <SAMRAI/tbox/MessageStream.h>
+
+
+SAMRAI::hier::Box box(SAMRAI::tbox::Dimension const& dimension, int lower, int upper)
+{
+    return SAMRAI::hier::Box{SAMRAI::hier::Index{dimension, lower},
+                             SAMRAI::hier::Index{dimension, upper}, SAMRAI::hier::BlockId{0}};
+}
+
+
+/*
+ * two patches of the given number of cells in each direction, and the overlap of the source
+ * domain on the destination ghost box, either with the destination next to the source, as for
+ * the patch ghost nodes, or on top of it, as when the fields of a level are copied to the new
+ * level at regrid. Patches have no geometry, as the temporary patches of SAMRAI transfers.
+ */
+template<std::size_t dim>
+struct PatchPair
+{
+    using PHARE_Types  = PHARE::core::PHARE_Types<dim, /*interp=*/1>;
+    using GridLayout_t = typename PHARE_Types::GridLayout_t;
+    using Field_t      = typename PHARE_Types::Field_t;
+    using FieldData_t  = PHARE::amr::FieldData<GridLayout_t, Field_t>;
+
+    PatchPair(int cells, bool neighbors)
+        : sourcePatch{box(dimension, cells, 2 * cells - 1), patchDescriptor}
+        , destPatch{neighbors ? box(dimension, 0, cells - 1) : sourcePatch.getBox(),
+                    patchDescriptor}
+        , sourceData{std::dynamic_pointer_cast<FieldData_t>(factory->allocate(sourcePatch))}
+        , destData{std::dynamic_pointer_cast<FieldData_t>(factory->allocate(destPatch))}
+    {
+        std::fill(sourceData->field.begin(), sourceData->field.end(), 1.);
+
+        SAMRAI::hier::Transformation const zero{SAMRAI::hier::IntVector::getZero(dimension)};
+        auto destGeom   = factory->getBoxGeometry(destPatch.getBox());
+        auto sourceGeom = factory->getBoxGeometry(sourcePatch.getBox());
+        overlap = std::dynamic_pointer_cast<PHARE::amr::FieldOverlap>(destGeom->calculateOverlap(
+            *sourceGeom, sourcePatch.getBox(), destData->getGhostBox(), true, zero));
+    }
+
+    SAMRAI::tbox::Dimension dimension{dim};
+
+    PHARE::amr::FieldVariable<GridLayout_t, Field_t> variable{
+        "EM_B_x", PHARE::core::HybridQuantity::Scalar::Bx};
+    std::shared_ptr<SAMRAI::hier::PatchDataFactory> factory{variable.getPatchDataFactory()};
+    std::shared_ptr<SAMRAI::hier::PatchDescriptor> patchDescriptor{
+        std::make_shared<SAMRAI::hier::PatchDescriptor>()};
+
+    SAMRAI::hier::Patch sourcePatch;
+    SAMRAI::hier::Patch destPatch;
+
+    std::shared_ptr<FieldData_t> sourceData;
+    std::shared_ptr<FieldData_t> destData;
+
+    std::shared_ptr<PHARE::amr::FieldOverlap> overlap;
+};
+
+
+template<std::size_t dim>
+void pack(benchmark::State& state)
+{
+    PatchPair<dim> patches(state.range(0), state.range(1));
+    auto const size = patches.sourceData->getDataStreamSize(*patches.overlap);
+
+    while (state.KeepRunning())
+    {
+        SAMRAI::tbox::MessageStream stream;
+        patches.sourceData->packStream(stream, *patches.overlap);
+        benchmark::DoNotOptimize(stream.getBufferStart());
+    }
+
+    PHARE::core::bench::setRate(state, "nodes/s", size / sizeof(double));
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
+
+template<std::size_t dim>
+void unpack(benchmark::State& state)
+{
+    PatchPair<dim> patches(state.range(0), state.range(1));
+    auto const size = patches.sourceData->getDataStreamSize(*patches.overlap);
+
+    SAMRAI::tbox::MessageStream packed;
+    patches.sourceData->packStream(packed, *patches.overlap);
+
+    while (state.KeepRunning())
+    {
+        SAMRAI::tbox::MessageStream stream{packed.getCurrentSize(),
+                                           SAMRAI::tbox::MessageStream::Read,
+                                           packed.getBufferStart()};
+        patches.destData->unpackStream(stream, *patches.overlap);
+        benchmark::ClobberMemory();
+    }
+
+    PHARE::core::bench::setRate(state, "nodes/s", size / sizeof(double));
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
+
+// arguments are the number of cells of the patches and whether they are neighbors
+BENCHMARK_TEMPLATE(pack, /*dim=*/1)->Args({1024, true})->Args({1024, false});
+BENCHMARK_TEMPLATE(pack, /*dim=*/2)->Args({128, true})->Args({128, false});
+BENCHMARK_TEMPLATE(pack, /*dim=*/3)->Args({32, true})->Args({32, false});
+
+BENCHMARK_TEMPLATE(unpack, /*dim=*/1)->Args({1024, true})->Args({1024, false});
+BENCHMARK_TEMPLATE(unpack, /*dim=*/2)->Args({128, true})->Args({128, false});
+BENCHMARK_TEMPLATE(unpack, /*dim=*/3)->Args({32, true})->Args({32, false});
+
+int main(int argc, char** argv)
+{
+    PHARE::SamraiLifeCycle samrai(argc, argv);
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
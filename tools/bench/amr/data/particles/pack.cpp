@@ -0,0 +1,132 @@
+#include "bench/core/bench.h"
+
+#include "amr/data/particles/particles_data.h"
+#include "phare/phare.h"
+
+#include <SAMRAI/hier/Patch.h>
+#include <SAMRAI/hier/PatchDescriptor.h>
+#include <SAMRAI/pdat/CellGeometry.h>
+#include <SAMRAI/tbox/MessageStream.h>
+
+constexpr std::size_t nbrPartPerCell = 100;
+
+
+SAMRAI::hier::Box box(SAMRAI::tbox::Dimension const& dimension, int lower, int upper)
+{
+    return SAMRAI::hier::Box{SAMRAI::hier::Index{dimension, lower},
+                             SAMRAI::hier::Index{dimension, upper}, SAMRAI::hier::BlockId{0}};
+}
+
+
+/*
+ * two patches of the given number of cells in each direction, the source full of particles, and
+ * the overlap of the source domain on the destination ghost box, either with the destination
+ * next to the source, as for the patch ghost particles, or on top of it, as when the particles
+ * of a level are copied to the new level at regrid
+ */
+template<std::size_t dim>
+struct PatchPair
+{
+    using PHARE_Types     = PHARE::core::PHARE_Types<dim, /*interp=*/1>;
+    using GridLayout_t    = typename PHARE_Types::GridLayout_t;
+    using ParticleArray_t = typename PHARE_Types::ParticleArray_t;
+    using Particle_t      = typename ParticleArray_t::value_type;
+    using ParticlesData_t = PHARE::amr::ParticlesData<ParticleArray_t>;
+
+    PatchPair(int cells, bool neighbors)
+        : sourceDomain{box(dimension, cells, 2 * cells - 1)}
+        , destDomain{neighbors ? box(dimension, 0, cells - 1) : sourceDomain}
+    {
+        auto layout   = PHARE::core::bench::layout<dim, 1>(cells);
+        auto nbrCells = std::size_t{1};
+        for (auto nbrCellsInDir : layout.nbrCells())
+            nbrCells *= nbrCellsInDir;
+
+        sourceData.domainParticles
+            = PHARE::core::bench::particles<ParticleArray_t>(layout, nbrPartPerCell * nbrCells);
+        for (auto& particle : sourceData.domainParticles)
+            for (auto& iCell : particle.iCell)
+                iCell += cells;
+
+        SAMRAI::pdat::CellGeometry destGeom{destDomain, ghost};
+        SAMRAI::pdat::CellGeometry sourceGeom{sourceDomain, ghost};
+        overlap = std::dynamic_pointer_cast<SAMRAI::pdat::CellOverlap>(destGeom.calculateOverlap(
+            sourceGeom, sourceData.getGhostBox(), destData.getGhostBox(), true,
+            SAMRAI::hier::Transformation{SAMRAI::hier::IntVector::getZero(dimension)}));
+    }
+
+    SAMRAI::tbox::Dimension dimension{dim};
+    SAMRAI::hier::IntVector ghost{dimension,
+                                  static_cast<int>(GridLayout_t::ghostWidthForParticles())};
+
+    SAMRAI::hier::Box sourceDomain;
+    SAMRAI::hier::Box destDomain;
+
+    ParticlesData_t sourceData{sourceDomain, ghost};
+    ParticlesData_t destData{destDomain, ghost};
+
+    std::shared_ptr<SAMRAI::pdat::CellOverlap> overlap;
+};
+
+
+template<std::size_t dim>
+void pack(benchmark::State& state)
+{
+    PatchPair<dim> patches(state.range(0), state.range(1));
+    auto const size = patches.sourceData.getDataStreamSize(*patches.overlap);
+
+    while (state.KeepRunning())
+    {
+        SAMRAI::tbox::MessageStream stream;
+        patches.sourceData.packStream(stream, *patches.overlap);
+        benchmark::DoNotOptimize(stream.getBufferStart());
+    }
+
+    PHARE::core::bench::setRate(state, "particles/s",
+                                size / sizeof(typename PatchPair<dim>::Particle_t));
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
+
+template<std::size_t dim>
+void unpack(benchmark::State& state)
+{
+    PatchPair<dim> patches(state.range(0), state.range(1));
+    auto& destData  = patches.destData;
+    auto const size = patches.sourceData.getDataStreamSize(*patches.overlap);
+
+    SAMRAI::tbox::MessageStream packed;
+    patches.sourceData.packStream(packed, *patches.overlap);
+
+    while (state.KeepRunning())
+    {
+        SAMRAI::tbox::MessageStream stream{packed.getCurrentSize(),
+                                           SAMRAI::tbox::MessageStream::Read,
+                                           packed.getBufferStart()};
+        destData.domainParticles.clear();
+        destData.patchGhostParticles.clear();
+        destData.unpackStream(stream, *patches.overlap);
+        benchmark::ClobberMemory();
+    }
+
+    PHARE::core::bench::setRate(state, "particles/s",
+                                size / sizeof(typename PatchPair<dim>::Particle_t));
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
+
+// arguments are the number of cells of the patches and whether they are neighbors
+BENCHMARK_TEMPLATE(pack, /*dim=*/1)->Args({64, true})->Args({64, false});
+BENCHMARK_TEMPLATE(pack, /*dim=*/2)->Args({32, true})->Args({32, false});
+BENCHMARK_TEMPLATE(pack, /*dim=*/3)->Args({16, true})->Args({16, false});
+
+BENCHMARK_TEMPLATE(unpack, /*dim=*/1)->Args({64, true})->Args({64, false});
+BENCHMARK_TEMPLATE(unpack, /*dim=*/2)->Args({32, true})->Args({32, false});
+BENCHMARK_TEMPLATE(unpack, /*dim=*/3)->Args({16, true})->Args({16, false});
+
+int main(int argc, char** argv)
+{
+    PHARE::SamraiLifeCycle samrai(argc, argv);
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
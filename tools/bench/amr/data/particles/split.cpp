@@ -0,0 +1,64 @@
+#include "bench/core/bench.h"
+
+#include "amr/data/particles/refine/split.h"
+
+constexpr std::uint32_t cells      = 32;
+constexpr std::size_t nbrParticles = 1e5;
+
+// splits each particle of the domain into the refined particles of the splitter
+template<std::size_t dim, std::size_t interp, std::size_t nbrRefinedParts>
+void split(benchmark::State& state)
+{
+    using PHARE_Types     = PHARE::core::PHARE_Types<dim, interp>;
+    using ParticleArray_t = typename PHARE_Types::ParticleArray_t;
+    using Splitter
+        = PHARE::amr::Splitter<PHARE::core::DimConst<dim>, PHARE::core::InterpConst<interp>,
+                               PHARE::core::RefinedParticlesConst<nbrRefinedParts>>;
+
+    auto layout    = PHARE::core::bench::layout<dim, interp>(cells);
+    auto particles = PHARE::core::bench::particles<ParticleArray_t>(layout, nbrParticles);
+    ParticleArray_t refinedParticles(nbrParticles * nbrRefinedParts);
+    Splitter splitter;
+
+    while (state.KeepRunning())
+    {
+        for (std::size_t iPart = 0; iPart < particles.size(); ++iPart)
+            splitter(particles[iPart], refinedParticles, iPart * nbrRefinedParts);
+        benchmark::ClobberMemory();
+    }
+
+    PHARE::core::bench::setRate(state, "particles/s", nbrParticles);
+    state.SetBytesProcessed(state.iterations() * refinedParticles.size()
+                            * sizeof(typename ParticleArray_t::value_type));
+}
+
+
+BENCHMARK_TEMPLATE(split, /*dim=*/1, /*interp=*/1, /*nbrRefinedParts=*/2);
+BENCHMARK_TEMPLATE(split, /*dim=*/1, /*interp=*/1, /*nbrRefinedParts=*/3);
+BENCHMARK_TEMPLATE(split, /*dim=*/1, /*interp=*/2, /*nbrRefinedParts=*/2);
+BENCHMARK_TEMPLATE(split, /*dim=*/1, /*interp=*/2, /*nbrRefinedParts=*/3);
+BENCHMARK_TEMPLATE(split, /*dim=*/1, /*interp=*/2, /*nbrRefinedParts=*/4);
+BENCHMARK_TEMPLATE(split, /*dim=*/1, /*interp=*/3, /*nbrRefinedParts=*/2);
+BENCHMARK_TEMPLATE(split, /*dim=*/1, /*interp=*/3, /*nbrRefinedParts=*/3);
+BENCHMARK_TEMPLATE(split, /*dim=*/1, /*interp=*/3, /*nbrRefinedParts=*/4);
+BENCHMARK_TEMPLATE(split, /*dim=*/1, /*interp=*/3, /*nbrRefinedParts=*/5);
+
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/1, /*nbrRefinedParts=*/4);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/1, /*nbrRefinedParts=*/5);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/1, /*nbrRefinedParts=*/8);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/1, /*nbrRefinedParts=*/9);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/2, /*nbrRefinedParts=*/4);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/2, /*nbrRefinedParts=*/5);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/2, /*nbrRefinedParts=*/8);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/2, /*nbrRefinedParts=*/9);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/2, /*nbrRefinedParts=*/16);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/3, /*nbrRefinedParts=*/4);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/3, /*nbrRefinedParts=*/5);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/3, /*nbrRefinedParts=*/8);
+BENCHMARK_TEMPLATE(split, /*dim=*/2, /*interp=*/3, /*nbrRefinedParts=*/25);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
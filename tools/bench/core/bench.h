@@ -0,0 +1,119 @@
+#ifndef PHARE_BENCH_CORE_BENCH_H
+#define PHARE_BENCH_CORE_BENCH_H
+
+#include "benchmark/benchmark.h"
+
+#include "phare_core.h"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+/*
+ * helpers shared by the benchmarks, which report their throughput with the counters below so
+ * that runs can be compared to a baseline, e.g. with google benchmark's tools/compare.py
+ */
+namespace PHARE::core::bench
+{
+// items processed per second, e.g. particles or cells
+inline void setRate(benchmark::State& state, std::string const& name, double itemsPerIteration)
+{
+    state.counters[name] = benchmark::Counter(itemsPerIteration * state.iterations(),
+                                              benchmark::Counter::kIsRate);
+}
+
+
+template<std::size_t dim, std::size_t interp>
+auto layout(std::uint32_t cells)
+{
+    using GridLayout_t = typename PHARE_Types<dim, interp>::GridLayout_t;
+    return GridLayout_t{ConstArray<double, dim>(1. / cells), ConstArray<std::uint32_t, dim>(cells),
+                        Point<double, dim>{ConstArray<double, dim>(0)}};
+}
+
+
+/*
+ * owns the fields of the Fields and VecFields of a benchmark, allocated on the given layout, as
+ * the resources manager does on a patch
+ */
+template<typename GridLayout>
+class FieldBuffers
+{
+public:
+    static constexpr auto dimension = GridLayout::dimension;
+    using Field_t = Field<NdArrayVector<dimension>, typename HybridQuantity::Scalar>;
+
+    FieldBuffers(GridLayout const& layout)
+        : layout_{layout}
+    {
+    }
+
+    Field_t& make(std::string const& name, HybridQuantity::Scalar qty, double value = 1)
+    {
+        auto& field = *fields_.emplace_back(
+            std::make_unique<Field_t>(name, qty, layout_.allocSize(qty)));
+        std::fill(field.begin(), field.end(), value);
+        return field;
+    }
+
+    template<typename VecField>
+    void set(VecField& vecField, double value = 1)
+    {
+        for (auto const& [name, qty] : vecField.getFieldNamesAndQuantities())
+            vecField.setBuffer(name, &make(name, qty, value));
+    }
+
+    // bytes of all fields made so far
+    std::size_t bytes() const
+    {
+        std::size_t size = 0;
+        for (auto const& field : fields_)
+            size += field->size() * sizeof(double);
+        return size;
+    }
+
+private:
+    GridLayout const& layout_;
+    std::vector<std::unique_ptr<Field_t>> fields_;
+};
+
+
+/*
+ * particles spread uniformly over the domain of the layout, with a fixed seed so that runs
+ * are comparable
+ */
+template<typename ParticleArray, typename GridLayout>
+ParticleArray particles(GridLayout const& layout, std::size_t nbrParticles)
+{
+    auto constexpr dim = GridLayout::dimension;
+    auto const box     = layout.AMRBox();
+
+    std::mt19937 gen{1};
+    std::uniform_real_distribution<float> delta{0, 1};
+    std::normal_distribution<double> velocity{0, 1};
+    std::vector<std::uniform_int_distribution<int>> cell;
+    for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        cell.emplace_back(box.lower[iDim], box.upper[iDim]);
+
+    ParticleArray particles(nbrParticles);
+    for (auto& particle : particles)
+    {
+        particle.weight = 1;
+        particle.charge = 1;
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        {
+            particle.iCell[iDim] = cell[iDim](gen);
+            particle.delta[iDim] = delta(gen);
+        }
+        for (auto& v : particle.v)
+            v = velocity(gen);
+    }
+    return particles;
+}
+
+} // namespace PHARE::core::bench
+
+#endif /* PHARE_BENCH_CORE_BENCH_H */
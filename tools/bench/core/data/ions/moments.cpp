@@ -0,0 +1,121 @@
+#include "bench/core/bench.h"
+
+#include "core/data/ions/ions.h"
+
+// the benchmarks take the number of cells of the patch in each direction and the number of
+// populations, whose moments the ions sum
+
+PHARE::initializer::PHAREDict createDict(std::size_t nbrPopulations)
+{
+    PHARE::initializer::PHAREDict dict;
+    dict["nbrPopulations"] = static_cast<int>(nbrPopulations);
+    for (std::size_t iPop = 0; iPop < nbrPopulations; ++iPop)
+    {
+        auto const pop                            = "pop" + std::to_string(iPop);
+        dict[pop]["name"]                         = pop;
+        dict[pop]["mass"]                         = 1.;
+        dict[pop]["particle_initializer"]["name"] = std::string{"maxwellian"};
+    }
+    return dict;
+}
+
+
+/*
+ * ions whose density and flux of each population are set to 1, on the fields and particles of
+ * the benchmark
+ */
+template<std::size_t dim>
+struct IonsBuffers
+{
+    using PHARE_Types     = PHARE::core::PHARE_Types<dim, /*interp=*/1>;
+    using GridLayout_t    = typename PHARE_Types::GridLayout_t;
+    using ParticleArray_t = typename PHARE_Types::ParticleArray_t;
+    using Ions_t          = typename PHARE_Types::Ions_t;
+
+    IonsBuffers(std::uint32_t cells, std::size_t nbrPopulations)
+        : layout{PHARE::core::bench::layout<dim, 1>(cells)}
+        , buffers{layout}
+        , ions{createDict(nbrPopulations)}
+        , packs(nbrPopulations)
+    {
+        using Scalar = PHARE::core::HybridQuantity::Scalar;
+
+        ions.setBuffer("rho", &buffers.make("rho", Scalar::rho));
+        buffers.set(ions.velocity());
+
+        auto& populations = ions.getRunTimeResourcesUserList();
+        for (std::size_t iPop = 0; iPop < nbrPopulations; ++iPop)
+        {
+            auto& pop  = populations[iPop];
+            auto& pack = packs[iPop];
+            pop.setBuffer(pop.name() + "_rho", &buffers.make(pop.name() + "_rho", Scalar::rho));
+            buffers.set(pop.flux());
+
+            pack.domainParticles        = &particles;
+            pack.patchGhostParticles    = &particles;
+            pack.levelGhostParticles    = &particles;
+            pack.levelGhostParticlesOld = &particles;
+            pack.levelGhostParticlesNew = &particles;
+            pop.setBuffer(pop.name(), &pack);
+        }
+    }
+
+    GridLayout_t layout;
+    PHARE::core::bench::FieldBuffers<GridLayout_t> buffers;
+    Ions_t ions;
+    ParticleArray_t particles;
+    std::vector<PHARE::core::ParticlesPack<ParticleArray_t>> packs;
+};
+
+
+template<std::size_t dim>
+void computeDensity(benchmark::State& state)
+{
+    IonsBuffers<dim> buffers(state.range(0), state.range(1));
+    auto& ions = buffers.ions;
+
+    while (state.KeepRunning())
+    {
+        ions.computeDensity();
+        benchmark::ClobberMemory();
+    }
+
+    auto const nbrNodes = ions.density().size();
+    PHARE::core::bench::setRate(state, "nodes/s", nbrNodes);
+    state.SetBytesProcessed(state.iterations() * nbrNodes * (state.range(1) + 1) * sizeof(double));
+}
+
+
+template<std::size_t dim>
+void computeBulkVelocity(benchmark::State& state)
+{
+    IonsBuffers<dim> buffers(state.range(0), state.range(1));
+    auto& ions = buffers.ions;
+    ions.computeDensity();
+
+    while (state.KeepRunning())
+    {
+        ions.computeBulkVelocity();
+        benchmark::ClobberMemory();
+    }
+
+    auto const nbrNodes = ions.density().size();
+    PHARE::core::bench::setRate(state, "nodes/s", nbrNodes);
+    state.SetBytesProcessed(state.iterations() * nbrNodes * (3 * state.range(1) + 4)
+                            * sizeof(double));
+}
+
+
+BENCHMARK_TEMPLATE(computeDensity, /*dim=*/1)->Ranges({{64, 4096}, {1, 4}});
+BENCHMARK_TEMPLATE(computeDensity, /*dim=*/2)->Ranges({{16, 256}, {1, 4}});
+BENCHMARK_TEMPLATE(computeDensity, /*dim=*/3)->Ranges({{8, 64}, {1, 4}});
+
+BENCHMARK_TEMPLATE(computeBulkVelocity, /*dim=*/1)->Ranges({{64, 4096}, {1, 4}});
+BENCHMARK_TEMPLATE(computeBulkVelocity, /*dim=*/2)->Ranges({{16, 256}, {1, 4}});
+BENCHMARK_TEMPLATE(computeBulkVelocity, /*dim=*/3)->Ranges({{8, 64}, {1, 4}});
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
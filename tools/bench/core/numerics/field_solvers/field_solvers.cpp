@@ -0,0 +1,125 @@
+#include "bench/core/bench.h"
+
+#include "core/numerics/ampere/ampere.h"
+#include "core/numerics/faraday/faraday.h"
+#include "core/numerics/ohm/ohm.h"
+
+// the benchmarks take the number of cells of the patch in each direction
+
+template<std::size_t dim>
+std::size_t nbrCells(benchmark::State const& state)
+{
+    std::size_t nbrCells = 1;
+    for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        nbrCells *= state.range(0);
+    return nbrCells;
+}
+
+
+template<std::size_t dim>
+void faraday(benchmark::State& state)
+{
+    using PHARE_Types = PHARE::core::PHARE_Types<dim, /*interp=*/1>;
+    using VecField_t  = typename PHARE_Types::VecField_t;
+    using Vector      = PHARE::core::HybridQuantity::Vector;
+
+    auto layout = PHARE::core::bench::layout<dim, 1>(state.range(0));
+    PHARE::core::bench::FieldBuffers buffers{layout};
+
+    VecField_t B{"B", Vector::B}, E{"E", Vector::E}, Bnew{"Bnew", Vector::B};
+    buffers.set(B);
+    buffers.set(E);
+    buffers.set(Bnew);
+
+    PHARE::core::Faraday<decltype(layout)> faraday;
+    faraday.setLayout(&layout);
+
+    while (state.KeepRunning())
+    {
+        faraday(B, E, Bnew, .001);
+        benchmark::ClobberMemory();
+    }
+
+    PHARE::core::bench::setRate(state, "cells/s", nbrCells<dim>(state));
+    state.SetBytesProcessed(state.iterations() * buffers.bytes());
+}
+
+
+template<std::size_t dim>
+void ampere(benchmark::State& state)
+{
+    using PHARE_Types = PHARE::core::PHARE_Types<dim, /*interp=*/1>;
+    using VecField_t  = typename PHARE_Types::VecField_t;
+    using Vector      = PHARE::core::HybridQuantity::Vector;
+
+    auto layout = PHARE::core::bench::layout<dim, 1>(state.range(0));
+    PHARE::core::bench::FieldBuffers buffers{layout};
+
+    VecField_t B{"B", Vector::B}, J{"J", Vector::J};
+    buffers.set(B);
+    buffers.set(J);
+
+    PHARE::core::Ampere<decltype(layout)> ampere;
+    ampere.setLayout(&layout);
+
+    while (state.KeepRunning())
+    {
+        ampere(B, J);
+        benchmark::ClobberMemory();
+    }
+
+    PHARE::core::bench::setRate(state, "cells/s", nbrCells<dim>(state));
+    state.SetBytesProcessed(state.iterations() * buffers.bytes());
+}
+
+
+template<std::size_t dim>
+void ohm(benchmark::State& state)
+{
+    using PHARE_Types = PHARE::core::PHARE_Types<dim, /*interp=*/1>;
+    using VecField_t  = typename PHARE_Types::VecField_t;
+    using Vector      = PHARE::core::HybridQuantity::Vector;
+    using Scalar      = PHARE::core::HybridQuantity::Scalar;
+
+    auto layout = PHARE::core::bench::layout<dim, 1>(state.range(0));
+    PHARE::core::bench::FieldBuffers buffers{layout};
+
+    auto& n  = buffers.make("n", Scalar::rho);
+    auto& Pe = buffers.make("Pe", Scalar::P);
+    VecField_t Ve{"Ve", Vector::V}, B{"B", Vector::B}, J{"J", Vector::J}, Enew{"Enew", Vector::E};
+    buffers.set(Ve);
+    buffers.set(B);
+    buffers.set(J);
+    buffers.set(Enew);
+
+    PHARE::core::Ohm<decltype(layout)> ohm;
+    ohm.setLayout(&layout);
+
+    while (state.KeepRunning())
+    {
+        ohm(n, Ve, Pe, B, J, Enew);
+        benchmark::ClobberMemory();
+    }
+
+    PHARE::core::bench::setRate(state, "cells/s", nbrCells<dim>(state));
+    state.SetBytesProcessed(state.iterations() * buffers.bytes());
+}
+
+
+BENCHMARK_TEMPLATE(faraday, /*dim=*/1)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(faraday, /*dim=*/2)->RangeMultiplier(2)->Range(16, 256);
+BENCHMARK_TEMPLATE(faraday, /*dim=*/3)->RangeMultiplier(2)->Range(8, 64);
+
+BENCHMARK_TEMPLATE(ampere, /*dim=*/1)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(ampere, /*dim=*/2)->RangeMultiplier(2)->Range(16, 256);
+BENCHMARK_TEMPLATE(ampere, /*dim=*/3)->RangeMultiplier(2)->Range(8, 64);
+
+BENCHMARK_TEMPLATE(ohm, /*dim=*/1)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(ohm, /*dim=*/2)->RangeMultiplier(2)->Range(16, 256);
+BENCHMARK_TEMPLATE(ohm, /*dim=*/3)->RangeMultiplier(2)->Range(8, 64);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
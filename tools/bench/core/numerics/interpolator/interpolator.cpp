@@ -0,0 +1,97 @@
+#include "bench/core/bench.h"
+
+#include "core/numerics/interpolator/interpolator.h"
+
+constexpr std::uint32_t cells      = 32;
+constexpr std::size_t nbrParticles = 1e6;
+
+
+// interpolates E and B on the particles
+template<std::size_t dim, std::size_t interp>
+void gather(benchmark::State& state)
+{
+    using PHARE_Types   = PHARE::core::PHARE_Types<dim, interp>;
+    using Interpolator  = PHARE::core::Interpolator<dim, interp>;
+    using Electromag_t  = typename PHARE_Types::Electromag_t;
+    using ParticleArray = typename PHARE_Types::ParticleArray_t;
+
+    auto layout = PHARE::core::bench::layout<dim, interp>(cells);
+    PHARE::core::bench::FieldBuffers buffers{layout};
+
+    Electromag_t em{std::string{"EM"}};
+    buffers.set(em.E);
+    buffers.set(em.B);
+
+    auto particles = PHARE::core::bench::particles<ParticleArray>(layout, nbrParticles);
+    Interpolator interpolator;
+
+    while (state.KeepRunning())
+    {
+        interpolator(std::begin(particles), std::end(particles), em, layout);
+        benchmark::ClobberMemory();
+    }
+
+    PHARE::core::bench::setRate(state, "particles/s", particles.size());
+    state.SetBytesProcessed(state.iterations() * particles.size() * sizeof(particles[0]));
+}
+
+
+// deposits the density and flux of the particles
+template<std::size_t dim, std::size_t interp>
+void deposit(benchmark::State& state)
+{
+    using PHARE_Types   = PHARE::core::PHARE_Types<dim, interp>;
+    using Interpolator  = PHARE::core::Interpolator<dim, interp>;
+    using VecField_t    = typename PHARE_Types::VecField_t;
+    using ParticleArray = typename PHARE_Types::ParticleArray_t;
+
+    auto layout = PHARE::core::bench::layout<dim, interp>(cells);
+    PHARE::core::bench::FieldBuffers buffers{layout};
+
+    auto& density = buffers.make("rho", PHARE::core::HybridQuantity::Scalar::rho, 0);
+    VecField_t flux{"flux", PHARE::core::HybridQuantity::Vector::V};
+    buffers.set(flux, 0);
+
+    auto particles = PHARE::core::bench::particles<ParticleArray>(layout, nbrParticles);
+    Interpolator interpolator;
+
+    while (state.KeepRunning())
+    {
+        interpolator(std::begin(particles), std::end(particles), density, flux, layout);
+        benchmark::ClobberMemory();
+    }
+
+    PHARE::core::bench::setRate(state, "particles/s", particles.size());
+    state.SetBytesProcessed(state.iterations() * particles.size() * sizeof(particles[0]));
+}
+
+
+BENCHMARK_TEMPLATE(gather, /*dim=*/1, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/1, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/1, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(gather, /*dim=*/2, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/2, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/2, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(gather, /*dim=*/3, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/3, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(gather, /*dim=*/3, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(deposit, /*dim=*/1, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/1, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/1, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(deposit, /*dim=*/2, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/2, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/2, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(deposit, /*dim=*/3, /*interp=*/1)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/3, /*interp=*/2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(deposit, /*dim=*/3, /*interp=*/3)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
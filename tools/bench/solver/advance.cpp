@@ -0,0 +1,96 @@
+#include "bench/core/bench.h"
+
+#include "amr/wrappers/hierarchy.h"
+#include "phare/phare.h"
+#include "simulator/simulator.h"
+
+#include "initializer/python_data_provider.h" // includes python, so last
+
+constexpr std::size_t dim = 1, interp = 1, nbRefinedPart = 2; // as in job.py
+
+using Simulator_t = PHARE::Simulator<dim, interp, nbRefinedPart>;
+using Hierarchy_t = std::shared_ptr<PHARE::amr::Hierarchy>;
+
+
+// domain particles of all populations on the levels minLevel to maxLevel, on this rank
+std::size_t nbrParticles(Simulator_t& simulator, PHARE::amr::Hierarchy& hierarchy, int minLevel,
+                         int maxLevel)
+{
+    using GridLayout_t = typename PHARE::core::PHARE_Types<dim, interp>::GridLayout_t;
+
+    auto& model      = *simulator.getHybridModel();
+    auto& ions       = model.state.ions;
+    std::size_t size = 0;
+
+    PHARE::amr::visitHierarchy<GridLayout_t>(
+        hierarchy, *model.resourcesManager,
+        [&](auto const& /*layout*/, auto const& /*patchID*/, auto /*iLevel*/) {
+            for (auto& pop : ions)
+                size += pop.domainParticles().size();
+        },
+        minLevel, maxLevel, ions);
+
+    return size;
+}
+
+
+// a step of the whole hierarchy, with the subcycles of the refined levels, particles are counted
+// once per step whatever their level
+void advance(benchmark::State& state, Simulator_t& simulator, Hierarchy_t const& hierarchy)
+{
+    while (state.KeepRunning())
+        simulator.advance(simulator.timeStep());
+
+    PHARE::core::bench::setRate(state, "particles/s",
+                                nbrParticles(simulator, *hierarchy, 0,
+                                             hierarchy->getNumberOfLevels() - 1));
+}
+
+
+/*
+ * a step of the root level alone, messengers included, as the time refinement integrator does it,
+ * time goes on from the current time of the simulator, which is not advanced anymore
+ */
+void advanceLevel(benchmark::State& state, Simulator_t& simulator, Hierarchy_t const& hierarchy)
+{
+    auto& integrator = *simulator.getMultiPhysicsIntegrator();
+    auto const level = hierarchy->getPatchLevel(0);
+    auto const dt    = simulator.timeStep();
+    auto time        = simulator.currentTime();
+
+    while (state.KeepRunning())
+    {
+        integrator.advanceLevel(level, hierarchy, time, time + dt, /*firstStep=*/true,
+                                /*lastStep=*/true);
+        time += dt;
+    }
+
+    PHARE::core::bench::setRate(state, "particles/s", nbrParticles(simulator, *hierarchy, 0, 0));
+}
+
+
+int main(int argc, char** argv)
+{
+    PHARE::SamraiLifeCycle samrai(argc, argv);
+    {
+        PHARE::initializer::PythonDataProvider input{"job"};
+        input.read();
+
+        auto hierarchy = PHARE::amr::Hierarchy::make();
+        auto simulator = PHARE::makeSimulator<dim, interp, nbRefinedPart>(hierarchy);
+        simulator->initialize();
+
+        // registered, hence run, in this order, advanceLevel leaves the simulator behind
+        benchmark::RegisterBenchmark("advance", [&](benchmark::State& state) {
+            advance(state, *simulator, hierarchy);
+        })->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark("advanceLevel", [&](benchmark::State& state) {
+            advanceLevel(state, *simulator, hierarchy);
+        })->Unit(benchmark::kMillisecond);
+
+        ::benchmark::Initialize(&argc, argv);
+        ::benchmark::RunSpecifiedBenchmarks();
+
+        PHARE::initializer::PHAREDictHandler::INSTANCE().stop();
+    }
+}
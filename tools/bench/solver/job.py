@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+
+import pyphare.pharein as ph
+from pyphare.pharein import ElectronModel
+
+# fixed refinement boxes, nothing is tagged, so that the hierarchy is the same at every step
+
+ph.Simulation(
+    smallest_patch_size=20,
+    largest_patch_size=64,
+    time_step_nbr=100000,
+    final_time=100.,
+    boundary_types="periodic",
+    cells=256,
+    dl=0.2,
+    refinement_boxes={"L0": {"B0": [(64,), (191,)]}},
+)
+
+density = lambda x: 1.
+
+bx = lambda x: 1.
+by, bz = (lambda x: 0. for i in range(2))
+vx, vy, vz = (lambda x: 0. for i in range(3))
+vthx, vthy, vthz = (lambda x: 0.3 for i in range(3))
+
+vvv = {
+    "vbulkx": vx, "vbulky": vy, "vbulkz": vz,
+    "vthx": vthx, "vthy": vthy, "vthz": vthz
+}
+
+ph.MaxwellianFluidModel(
+    bx=bx, by=by, bz=bz,
+    protons={"charge": 1, "density": density, **vvv}
+)
+
+ElectronModel(closure="isothermal", Te=0.12)